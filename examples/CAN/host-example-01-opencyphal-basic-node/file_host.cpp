@@ -0,0 +1,135 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal-Support/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "file_host.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <cstring>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support::platform::file::host
+{
+
+/**************************************************************************************
+ * CTOR/DTOR
+ **************************************************************************************/
+
+FileSource::FileSource(std::string const & root_dir)
+: _root_dir{root_dir}
+, _mappings{}
+, _next_mapping{0}
+{ }
+
+FileSource::~FileSource()
+{
+  for (auto & mapping : _mappings)
+    unmap(mapping);
+}
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+auto FileSource::read(const std::string_view path,
+                      const std::uint64_t offset,
+                      const std::size_t size,
+                      void* const data) -> std::variant<Error, std::size_t>
+{
+  auto const rc = map(path);
+  if (std::holds_alternative<Error>(rc))
+    return std::get<Error>(rc);
+
+  Mapping const * mapping = std::get<Mapping const *>(rc);
+  if (offset >= mapping->size)
+    return static_cast<std::size_t>(0);
+
+  std::size_t const bytes_read = std::min(size, static_cast<std::size_t>(mapping->size - offset));
+  memcpy(data, static_cast<uint8_t const *>(mapping->addr) + offset, bytes_read);
+  return bytes_read;
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+auto FileSource::map(const std::string_view path) -> std::variant<Error, Mapping const *>
+{
+  for (auto const & mapping : _mappings)
+    if (!mapping.path.empty() && (mapping.path == path))
+      return &mapping;
+
+  /* Do not serve anything outside of the root directory. */
+  if (path.empty() || (path.front() == '/') || (path.find("..") != std::string_view::npos))
+    return Error::Access;
+
+  std::string const filename = _root_dir + "/" + std::string(path);
+
+  int const fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return (errno == ENOENT) ? Error::Existence : Error::Access;
+
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    return Error::IO;
+  }
+  if (S_ISDIR(st.st_mode)) {
+    close(fd);
+    return Error::IsDirectory;
+  }
+
+  /* Empty files can not be mapped but are valid nonetheless. */
+  void * addr = nullptr;
+  if (st.st_size > 0)
+  {
+    addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      close(fd);
+      return Error::IO;
+    }
+  }
+  close(fd);
+
+  /* Evict the oldest mapping in a round-robin fashion. */
+  Mapping & mapping = _mappings[_next_mapping];
+  _next_mapping = (_next_mapping + 1) % MAX_MAPPINGS;
+
+  unmap(mapping);
+  mapping.path = std::string(path);
+  mapping.addr = addr;
+  mapping.size = static_cast<size_t>(st.st_size);
+
+  return &mapping;
+}
+
+void FileSource::unmap(Mapping & mapping)
+{
+  if (mapping.addr)
+    munmap(mapping.addr, mapping.size);
+
+  mapping.path.clear();
+  mapping.addr = nullptr;
+  mapping.size = 0;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support::platform::file::host */
@@ -0,0 +1,69 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal-Support/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <107-Arduino-Cyphal.h>
+
+#include <array>
+#include <string>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support::platform::file::host
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Serves the files below a root directory. Files are memory mapped
+ * upon first access and remain mapped, so that reads are a mere copy
+ * from the mapping into the response of the file server.
+ */
+class FileSource final : public interface::FileSource
+{
+public:
+  FileSource(std::string const & root_dir);
+  virtual ~FileSource();
+
+  /// Copies up to size bytes of the file starting at offset into the buffer.
+  /// The return value is the number of bytes read into the buffer or the error.
+  [[nodiscard]] virtual auto read(const std::string_view path,
+                                  const std::uint64_t offset,
+                                  const std::size_t size,
+                                  void* const data) -> std::variant<Error, std::size_t> override;
+
+private:
+  static size_t constexpr MAX_MAPPINGS = 8;
+
+  struct Mapping
+  {
+    std::string path;
+    void * addr;
+    size_t size;
+  };
+
+  std::string const _root_dir;
+  std::array<Mapping, MAX_MAPPINGS> _mappings;
+  size_t _next_mapping;
+
+  [[nodiscard]] auto map(const std::string_view path) -> std::variant<Error, Mapping const *>;
+  static void unmap(Mapping & mapping);
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support::platform::file::host */
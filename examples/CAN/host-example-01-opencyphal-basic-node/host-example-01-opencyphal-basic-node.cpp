@@ -21,6 +21,7 @@
 #include <cyphal++/cyphal++.h>
 
 #include "kv_host.h"
+#include "file_host.h"
 #include "socketcan.h"
 
 /**************************************************************************************
@@ -49,6 +50,7 @@ uavcan::node::ExecuteCommand::Response_1_1 onExecuteCommand_1_1_Request_Received
  **************************************************************************************/
 
 static cyphal::support::platform::storage::host::KeyValueStorage kv_storage;
+static cyphal::support::platform::file::host::FileSource file_source(".");
 static std::shared_ptr<cyphal::registry::Registry> node_registry;
 
 /**************************************************************************************
@@ -128,6 +130,9 @@ int main(int argc, char ** argv)
     "107-systems.basic-cyphal-node"
   );
 
+  /* Serve the files of the working directory via uavcan.file.Read. */
+  const auto file_server = node_hdl.create_file_server(file_source);
+
   std::atomic<bool> rx_thread_active{false};
   std::thread rx_thread(
     [&rx_thread_active, &node_hdl, &node_mtx, socket_can_fd]()
@@ -138,12 +143,20 @@ int main(int argc, char ** argv)
         CanardFrame rx_frame;
         uint8_t payload_buffer[CANARD_MTU_CAN_CLASSIC] = {0};
 
-        int16_t const rc = socketcanPop(socket_can_fd, &rx_frame, sizeof(payload_buffer), payload_buffer, CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC, nullptr);
+        bool loopback = false;
+
+        int16_t const rc = socketcanPop(socket_can_fd, &rx_frame, sizeof(payload_buffer), payload_buffer, CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC, &loopback);
         if (rc < 0)
           std::cerr << "socketcanPop failed with error " << strerror(abs(rc)) << std::endl;
         else if (rc > 0) {
           std::lock_guard<std::mutex> lock(node_mtx);
-          node_hdl.onCanFrameReceived(rx_frame);
+          /* Frames sent by this node are looped back by the kernel
+           * once transmitted and serve as TX-done indication.
+           */
+          if (loopback)
+            node_hdl.onCanFrameTransmitted(rx_frame, micros());
+          else
+            node_hdl.onCanFrameReceived(rx_frame);
         }
 
         std::this_thread::yield();
@@ -0,0 +1,139 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <ctime>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <memory>
+#include <iostream>
+
+#include <cyphal++/cyphal++.h>
+
+#include <fcntl.h>
+#include <stdlib.h>
+
+#include "serial_host.h"
+
+/**************************************************************************************
+ * CONSTANT
+ **************************************************************************************/
+
+static uint16_t const HEARTBEAT_UPDATE_PERIOD_ms = 1000UL;
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+CanardMicrosecond micros();
+unsigned long millis();
+
+/**************************************************************************************
+ * MAIN
+ **************************************************************************************/
+
+int main(int argc, char ** argv)
+{
+  /* Either a serial device, e.g. /dev/ttyACM0, or "pty" for a
+   * pseudo terminal, which is the default.
+   */
+  std::string const device_path = (argc > 1) ? argv[1] : "pty";
+
+  int fd = -1;
+  if (device_path == "pty")
+  {
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((fd < 0) || (grantpt(fd) != 0) || (unlockpt(fd) != 0)) {
+      std::cerr << "Error creating pseudo terminal" << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "Serial port: " << ptsname(fd) << std::endl;
+  }
+
+  auto serial_port = (fd >= 0) ? std::make_unique<cyphal::support::platform::serial::host::SerialPort>(fd)
+                               : std::make_unique<cyphal::support::platform::serial::host::SerialPort>(device_path);
+  if (!serial_port->is_open()) {
+    std::cerr << "Error opening serial port '" << device_path << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
+  cyphal::Node::Heap<cyphal::Node::DEFAULT_O1HEAP_SIZE> node_heap;
+  cyphal::Node node_hdl(node_heap.data(), node_heap.size(), micros, *serial_port, 42);
+
+  cyphal::Publisher<uavcan::node::Heartbeat_1_0> heartbeat_pub = node_hdl.create_publisher<uavcan::node::Heartbeat_1_0>(1*1000*1000UL /* = 1 sec in usecs. */);
+
+  cyphal::Subscription heartbeat_sub = node_hdl.create_subscription<uavcan::node::Heartbeat_1_0>(
+    [](uavcan::node::Heartbeat_1_0 const & msg, cyphal::TransferMetadata const & metadata)
+    {
+      std::cout << "Heartbeat of node " << metadata.remote_node_id << ", uptime " << msg.uptime << " s" << std::endl;
+    });
+
+  cyphal::NodeInfo node_info = node_hdl.create_node_info(
+    /* cyphal.node.Version.1.0 protocol_version */
+    1, 0,
+    /* cyphal.node.Version.1.0 hardware_version */
+    1, 0,
+    /* cyphal.node.Version.1.0 software_version */
+    0, 1,
+    /* saturated uint64 software_vcs_revision_id */
+    0,
+    /* saturated uint8[16] unique_id */
+    std::array<uint8_t, 16>{0x53, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x2d, 0x4e, 0x4f, 0x44, 0x45, 0x33, 0x00, 0x00, 0x00, 0x01},
+    /* saturated uint8[<=50] name */
+    "serial-cyphal-node"
+  );
+
+  auto prev_heartbeat = millis();
+
+  for (;;)
+  {
+    node_hdl.spinSome();
+
+    auto const now = millis();
+
+    if ((now - prev_heartbeat) > HEARTBEAT_UPDATE_PERIOD_ms)
+    {
+      uavcan::node::Heartbeat_1_0 msg;
+
+      msg.uptime = now / 1000;
+      msg.health.value = uavcan::node::Health_1_0::NOMINAL;
+      msg.mode.value = uavcan::node::Mode_1_0::OPERATIONAL;
+      msg.vendor_specific_status_code = 0;
+
+      heartbeat_pub->publish(msg);
+      prev_heartbeat = now;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+CanardMicrosecond micros()
+{
+  ::timespec ts{};
+  if (0 != clock_gettime(CLOCK_MONOTONIC, &ts))
+  {
+    std::cerr << "CLOCK_MONOTONIC" << std::endl;
+    std::abort();
+  }
+  auto const nsec = (ts.tv_sec * 1000*1000*1000UL) + ts.tv_nsec;
+  return static_cast<CanardMicrosecond>(nsec / 1000UL);
+}
+
+unsigned long millis()
+{
+  return micros() / 1000;
+}
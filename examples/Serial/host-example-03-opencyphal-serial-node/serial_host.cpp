@@ -0,0 +1,129 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal-Support/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "serial_host.h"
+
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <termios.h>
+
+#include <cerrno>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support::platform::serial::host
+{
+
+/**************************************************************************************
+ * CTOR/DTOR
+ **************************************************************************************/
+
+SerialPort::SerialPort(std::string const & device_path)
+: SerialPort(::open(device_path.c_str(), O_RDWR | O_NOCTTY))
+{ }
+
+SerialPort::SerialPort(int const fd)
+: _fd{configure(fd)}
+{ }
+
+SerialPort::~SerialPort()
+{
+  if (_fd >= 0)
+    close(_fd);
+}
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+auto SerialPort::write(const void* const data, const std::size_t size) -> std::optional<Error>
+{
+  if (_fd < 0)
+    return Error::API;
+
+  uint8_t const * ptr = static_cast<uint8_t const *>(data);
+  size_t num_written = 0;
+
+  while (num_written < size)
+  {
+    ssize_t const rc = ::write(_fd, ptr + num_written, size - num_written);
+    if (rc > 0) {
+      num_written += static_cast<size_t>(rc);
+      continue;
+    }
+
+    if ((rc < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))
+      return Error::IO;
+
+    /* Either all or none of the bytes are written. */
+    if (num_written == 0)
+      return Error::Busy;
+
+    pollfd pfd{_fd, POLLOUT, 0};
+    if (poll(&pfd, 1, WRITE_TIMEOUT_ms) <= 0)
+      return Error::IO;
+  }
+
+  return std::nullopt;
+}
+
+auto SerialPort::read(void* const data, const std::size_t size) -> std::variant<Error, std::size_t>
+{
+  if (_fd < 0)
+    return Error::API;
+
+  ssize_t const rc = ::read(_fd, data, size);
+  if (rc < 0)
+  {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+      return static_cast<std::size_t>(0);
+    return Error::IO;
+  }
+
+  return static_cast<std::size_t>(rc);
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+int SerialPort::configure(int const fd)
+{
+  if (fd < 0)
+    return -1;
+
+  termios tio{};
+  if (tcgetattr(fd, &tio) == 0)
+  {
+    cfmakeraw(&tio);
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+      close(fd);
+      return -1;
+    }
+  }
+
+  int const flags = fcntl(fd, F_GETFL, 0);
+  if ((flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)) {
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support::platform::serial::host */
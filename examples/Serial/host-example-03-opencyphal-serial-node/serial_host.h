@@ -0,0 +1,65 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal-Support/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <107-Arduino-Cyphal.h>
+
+#include <string>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support::platform::serial::host
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Non-blocking serial port on top of a file descriptor, i.e. a
+ * serial device (e.g. /dev/ttyACM0) or a pseudo terminal, which
+ * is switched into raw mode.
+ */
+class SerialPort final : public interface::SerialPort
+{
+public:
+  /* Opens a serial device. */
+  SerialPort(std::string const & device_path);
+  /* Takes ownership of an already open file descriptor, e.g. the
+   * master side of a pseudo terminal created via posix_openpt().
+   */
+  explicit SerialPort(int const fd);
+  virtual ~SerialPort();
+
+
+  [[nodiscard]] bool is_open() const { return _fd >= 0; }
+
+  /// Writes all bytes, waiting for at most WRITE_TIMEOUT_ms once the first bytes have been written.
+  [[nodiscard]] virtual auto write(const void* const data, const std::size_t size) -> std::optional<Error> override;
+
+  [[nodiscard]] virtual auto read(void* const data, const std::size_t size) -> std::variant<Error, std::size_t> override;
+
+
+private:
+  static int constexpr WRITE_TIMEOUT_ms = 100;
+
+  int _fd;
+
+  static int configure(int const fd);
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support::platform::serial::host */
@@ -0,0 +1,121 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <ctime>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+
+#include <cyphal++/cyphal++.h>
+
+#include "udp_host.h"
+
+/**************************************************************************************
+ * CONSTANT
+ **************************************************************************************/
+
+static uint16_t const HEARTBEAT_UPDATE_PERIOD_ms = 1000UL;
+
+/**************************************************************************************
+ * FUNCTION DECLARATION
+ **************************************************************************************/
+
+CanardMicrosecond micros();
+unsigned long millis();
+
+/**************************************************************************************
+ * MAIN
+ **************************************************************************************/
+
+int main(int argc, char ** argv)
+{
+  std::string const iface_address = (argc > 1) ? argv[1] : "127.0.0.1";
+
+  cyphal::support::platform::udp::host::UdpSocket udp_socket(iface_address);
+  if (!udp_socket.is_open()) {
+    std::cerr << "Error opening UDP socket on '" << iface_address << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  cyphal::Node::Heap<cyphal::Node::DEFAULT_O1HEAP_SIZE> node_heap;
+  cyphal::Node node_hdl(node_heap.data(), node_heap.size(), micros, udp_socket, 42);
+
+  cyphal::Publisher<uavcan::node::Heartbeat_1_0> heartbeat_pub = node_hdl.create_publisher<uavcan::node::Heartbeat_1_0>(1*1000*1000UL /* = 1 sec in usecs. */);
+
+  cyphal::Subscription heartbeat_sub = node_hdl.create_subscription<uavcan::node::Heartbeat_1_0>(
+    [](uavcan::node::Heartbeat_1_0 const & msg, cyphal::TransferMetadata const & metadata)
+    {
+      std::cout << "Heartbeat of node " << metadata.remote_node_id << ", uptime " << msg.uptime << " s" << std::endl;
+    });
+
+  cyphal::NodeInfo node_info = node_hdl.create_node_info(
+    /* cyphal.node.Version.1.0 protocol_version */
+    1, 0,
+    /* cyphal.node.Version.1.0 hardware_version */
+    1, 0,
+    /* cyphal.node.Version.1.0 software_version */
+    0, 1,
+    /* saturated uint64 software_vcs_revision_id */
+    0,
+    /* saturated uint8[16] unique_id */
+    std::array<uint8_t, 16>{0x54, 0x55, 0x44, 0x50, 0x2d, 0x4e, 0x4f, 0x44, 0x45, 0x2d, 0x30, 0x32, 0x00, 0x00, 0x00, 0x01},
+    /* saturated uint8[<=50] name */
+    "udp-cyphal-node"
+  );
+
+  auto prev_heartbeat = millis();
+
+  for (;;)
+  {
+    node_hdl.spinSome();
+
+    auto const now = millis();
+
+    if ((now - prev_heartbeat) > HEARTBEAT_UPDATE_PERIOD_ms)
+    {
+      uavcan::node::Heartbeat_1_0 msg;
+
+      msg.uptime = now / 1000;
+      msg.health.value = uavcan::node::Health_1_0::NOMINAL;
+      msg.mode.value = uavcan::node::Mode_1_0::OPERATIONAL;
+      msg.vendor_specific_status_code = 0;
+
+      heartbeat_pub->publish(msg);
+      prev_heartbeat = now;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+CanardMicrosecond micros()
+{
+  ::timespec ts{};
+  if (0 != clock_gettime(CLOCK_MONOTONIC, &ts))
+  {
+    std::cerr << "CLOCK_MONOTONIC" << std::endl;
+    std::abort();
+  }
+  auto const nsec = (ts.tv_sec * 1000*1000*1000UL) + ts.tv_nsec;
+  return static_cast<CanardMicrosecond>(nsec / 1000UL);
+}
+
+unsigned long millis()
+{
+  return micros() / 1000;
+}
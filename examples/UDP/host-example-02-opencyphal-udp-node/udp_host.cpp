@@ -0,0 +1,174 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal-Support/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "udp_host.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <array>
+#include <cerrno>
+#include <algorithm>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support::platform::udp::host
+{
+
+/**************************************************************************************
+ * CTOR/DTOR
+ **************************************************************************************/
+
+UdpSocket::UdpSocket(std::string const & local_iface_address)
+: _fd{-1}
+, _local_iface_address{INADDR_ANY}
+{
+  in_addr iface{};
+  if (inet_pton(AF_INET, local_iface_address.c_str(), &iface) != 1)
+    return;
+  _local_iface_address = iface.s_addr;
+
+  int const fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, IPPROTO_UDP);
+  if (fd < 0)
+    return;
+
+  int const enable = 1, disable = 0, ttl = 16;
+  sockaddr_in addr{};
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons(CYPHAL_UDP_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+  /* Only deliver the groups joined via this socket,
+   * which is not the default on Linux.
+   */
+  bool const is_configured =
+    (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR,       &enable,         sizeof(enable))  == 0) &&
+    (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT,       &enable,         sizeof(enable))  == 0) &&
+    (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_ALL,   &disable,        sizeof(disable)) == 0) &&
+    (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP,  &enable,         sizeof(enable))  == 0) &&
+    (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL,   &ttl,            sizeof(ttl))     == 0) &&
+    (setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF,    &iface,          sizeof(iface))   == 0) &&
+    (bind(fd, reinterpret_cast<sockaddr const *>(&addr), sizeof(addr)) == 0);
+
+  if (!is_configured) {
+    close(fd);
+    return;
+  }
+
+  _fd = fd;
+}
+
+UdpSocket::~UdpSocket()
+{
+  if (_fd >= 0)
+    close(_fd);
+}
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+auto UdpSocket::send(const std::uint32_t group_address,
+                     const Fragment* const fragments,
+                     const std::size_t num_fragments) -> std::optional<Error>
+{
+  if ((_fd < 0) || (num_fragments > MAX_FRAGMENTS))
+    return Error::API;
+
+  sockaddr_in addr{};
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons(CYPHAL_UDP_PORT);
+  addr.sin_addr.s_addr = htonl(group_address);
+
+  std::array<iovec, MAX_FRAGMENTS> iov;
+  for (size_t i = 0; i < num_fragments; i++)
+    iov[i] = iovec{const_cast<void *>(fragments[i].data), fragments[i].size};
+
+  msghdr msg{};
+  msg.msg_name    = &addr;
+  msg.msg_namelen = sizeof(addr);
+  msg.msg_iov     = iov.data();
+  msg.msg_iovlen  = num_fragments;
+
+  if (sendmsg(_fd, &msg, 0) < 0)
+    return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == ENOBUFS)) ? Error::Busy : Error::IO;
+
+  return std::nullopt;
+}
+
+auto UdpSocket::receive(Datagram* const datagrams,
+                        const std::size_t num_datagrams) -> std::variant<Error, std::size_t>
+{
+  if (_fd < 0)
+    return Error::API;
+
+  size_t const batch_size = std::min(num_datagrams, MAX_BATCH_SIZE);
+
+  std::array<iovec, MAX_BATCH_SIZE> iov;
+  std::array<mmsghdr, MAX_BATCH_SIZE> msgs{};
+  for (size_t i = 0; i < batch_size; i++)
+  {
+    iov[i] = iovec{datagrams[i].data, datagrams[i].capacity};
+    msgs[i].msg_hdr.msg_iov    = &iov[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  int const rc = recvmmsg(_fd, msgs.data(), batch_size, MSG_DONTWAIT, nullptr);
+  if (rc < 0)
+  {
+    if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+      return static_cast<std::size_t>(0);
+    return Error::IO;
+  }
+
+  for (int i = 0; i < rc; i++)
+    datagrams[i].size = msgs[i].msg_len;
+
+  return static_cast<std::size_t>(rc);
+}
+
+auto UdpSocket::join(const std::uint32_t group_address) -> std::optional<Error>
+{
+  if (_fd < 0)
+    return Error::API;
+
+  ip_mreq mreq{};
+  mreq.imr_multiaddr.s_addr = htonl(group_address);
+  mreq.imr_interface.s_addr = _local_iface_address;
+
+  if ((setsockopt(_fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0) && (errno != EADDRINUSE))
+    return Error::IO;
+
+  return std::nullopt;
+}
+
+void UdpSocket::leave(const std::uint32_t group_address)
+{
+  if (_fd < 0)
+    return;
+
+  ip_mreq mreq{};
+  mreq.imr_multiaddr.s_addr = htonl(group_address);
+  mreq.imr_interface.s_addr = _local_iface_address;
+
+  setsockopt(_fd, IPPROTO_IP, IP_DROP_MEMBERSHIP, &mreq, sizeof(mreq));
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support::platform::udp::host */
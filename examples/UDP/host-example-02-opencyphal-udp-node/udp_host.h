@@ -0,0 +1,70 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal-Support/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <107-Arduino-Cyphal.h>
+
+#include <string>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support::platform::udp::host
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Non-blocking IPv4 multicast socket on the network interface with
+ * the given local address, e.g. "127.0.0.1" for testing on loopback.
+ * Datagrams are sent via sendmsg() straight from the fragments and
+ * received in batches via recvmmsg(). Several nodes (or processes)
+ * on the same host may use a socket each.
+ */
+class UdpSocket final : public interface::UdpSocket
+{
+public:
+  static uint16_t constexpr CYPHAL_UDP_PORT = 9382;
+
+
+  UdpSocket(std::string const & local_iface_address);
+  virtual ~UdpSocket();
+
+
+  [[nodiscard]] bool is_open() const { return _fd >= 0; }
+
+  [[nodiscard]] virtual auto send(const std::uint32_t group_address,
+                                  const Fragment* const fragments,
+                                  const std::size_t num_fragments) -> std::optional<Error> override;
+
+  [[nodiscard]] virtual auto receive(Datagram* const datagrams,
+                                     const std::size_t num_datagrams) -> std::variant<Error, std::size_t> override;
+
+  [[nodiscard]] virtual auto join(const std::uint32_t group_address) -> std::optional<Error> override;
+  virtual void leave(const std::uint32_t group_address) override;
+
+
+private:
+  static size_t constexpr MAX_FRAGMENTS = 8;
+  static size_t constexpr MAX_BATCH_SIZE = 32;
+
+  int _fd;
+  uint32_t _local_iface_address;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support::platform::udp::host */
@@ -0,0 +1,39 @@
+#!/bin/sh
+#
+# Generates one umbrella header per DSDL namespace below src/DSDL_Types,
+# e.g. src/DSDL_Types/uavcan/node.h includes all types of uavcan.node
+# including those of nested namespaces. Including only the namespaces
+# actually needed instead of DSDL_Types.h considerably reduces the
+# amount of headers to be parsed per translation unit.
+
+SCRIPT_DIR=$(dirname $(readlink -f "$0"))
+SRC_DIR="$SCRIPT_DIR/../../src"
+UMBRELLA_DIR="$SRC_DIR/DSDL_Types"
+
+cd $SRC_DIR
+rm -rf "$UMBRELLA_DIR"
+
+for ns_dir in $(find types -mindepth 1 -type d | sort)
+do
+    ns_path=${ns_dir#types/}
+    ns_name=$(basename $ns_path)
+    umbrella="$UMBRELLA_DIR/$ns_path.h"
+    mkdir -p $(dirname $umbrella)
+
+    printf "/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */\n\n" > $umbrella
+    printf "#pragma once\n\n" >> $umbrella
+    printf "#pragma GCC diagnostic push\n" >> $umbrella
+    printf "#pragma GCC diagnostic ignored \"-Wtype-limits\"\n" >> $umbrella
+    printf "#pragma GCC diagnostic ignored \"-Wattributes\"\n" >> $umbrella
+    printf "#pragma GCC diagnostic ignored \"-Wunused-parameter\"\n" >> $umbrella
+    printf "#pragma GCC diagnostic ignored \"-Wdeprecated-declarations\"\n" >> $umbrella
+    for t in $(find $ns_dir -mindepth 1 -maxdepth 1 -type f -name "*.hpp" | sort)
+    do
+        printf "#include <%s>\n" $t >> $umbrella
+    done
+    for sub_ns_dir in $(find $ns_dir -mindepth 1 -maxdepth 1 -type d | sort)
+    do
+        printf "#include \"%s/%s.h\"\n" $ns_name $(basename $sub_ns_dir) >> $umbrella
+    done
+    printf "#pragma GCC diagnostic pop\n" >> $umbrella
+done
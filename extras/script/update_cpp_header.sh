@@ -23,6 +23,7 @@ nnvg --experimental-languages \
      --pp-max-emptylines=1  \
      --pp-trim-trailing-whitespace \
      --target-endianness=any \
+     --configuration "$SCRIPT_DIR/nunavut_cpp.yaml" \
      --outdir public_regulated_data_types/uavcan-header \
      public_regulated_data_types/uavcan
 nnvg --experimental-languages \
@@ -31,6 +32,7 @@ nnvg --experimental-languages \
      --pp-max-emptylines=1  \
      --pp-trim-trailing-whitespace \
      --target-endianness=any \
+     --configuration "$SCRIPT_DIR/nunavut_cpp.yaml" \
      --lookup public_regulated_data_types/uavcan \
      --outdir public_regulated_data_types/reg-header \
      public_regulated_data_types/reg
@@ -40,6 +42,7 @@ nnvg --experimental-languages \
      --pp-max-emptylines=1  \
      --pp-trim-trailing-whitespace \
      --target-endianness=any \
+     --configuration "$SCRIPT_DIR/nunavut_cpp.yaml" \
      --lookup public_regulated_data_types/uavcan \
      --outdir zubax_dsdl/zubax/zubax-header \
      zubax_dsdl/zubax
@@ -71,3 +74,6 @@ for i in $(find ./types -type f -name "*.hpp" -printf "%P\n")
 do
     printf "#include \"types/%s\" \n" $i >> DSDL_Types.h.impl
 done
+
+echo "Generating per-namespace umbrella headers"
+$SCRIPT_DIR/generate_dsdl_umbrella_headers.sh
@@ -0,0 +1,104 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <107-Arduino-Cyphal.h>
+
+#include <deque>
+#include <vector>
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Two nodes connected via a simulated CAN bus, sharing a clock
+ * which only advances within spin(). Frames are queued per
+ * direction and delivered from within spin(), unless a direction
+ * is held back (e.g. to delay or replay responses).
+ */
+class NodeLoopback
+{
+public:
+  static CanardNodeID constexpr NODE_ID_A = 10;
+  static CanardNodeID constexpr NODE_ID_B = 20;
+  static size_t       constexpr TX_QUEUE_SIZE = 512;
+
+  struct Frame
+  {
+    uint32_t extended_can_id;
+    std::vector<uint8_t> payload;
+  };
+
+
+  explicit NodeLoopback(size_t const mtu_bytes = CANARD_MTU_CAN_CLASSIC)
+  : now_usec{1000*1000UL}
+  , hold_a_to_b{false}
+  , hold_b_to_a{false}
+  , a{_heap_a.data(), _heap_a.size(), [this]() { return now_usec; }, [this](CanardFrame const & f) { return tx(a_to_b, f); }, NODE_ID_A, TX_QUEUE_SIZE, cyphal::Node::DEFAULT_RX_QUEUE_SIZE, mtu_bytes}
+  , b{_heap_b.data(), _heap_b.size(), [this]() { return now_usec; }, [this](CanardFrame const & f) { return tx(b_to_a, f); }, NODE_ID_B, TX_QUEUE_SIZE, cyphal::Node::DEFAULT_RX_QUEUE_SIZE, mtu_bytes}
+  { }
+
+
+  /* Advances the clock and lets both nodes transmit and process
+   * all frames which are not held back.
+   */
+  void spin(CanardMicrosecond const step_usec = 1000)
+  {
+    now_usec += step_usec;
+    a.spinSome();
+    b.spinSome();
+    if (!hold_a_to_b) deliver(a_to_b, b);
+    if (!hold_b_to_a) deliver(b_to_a, a);
+  }
+
+  void spin_for(CanardMicrosecond const duration_usec, CanardMicrosecond const step_usec = 1000)
+  {
+    for (CanardMicrosecond t = 0; t < duration_usec; t += step_usec)
+      spin(step_usec);
+  }
+
+  static void deliver(std::deque<Frame> & frames, cyphal::Node & node)
+  {
+    while (!frames.empty())
+    {
+      Frame const & f = frames.front();
+      CanardFrame const frame{f.extended_can_id, f.payload.size(), f.payload.data()};
+      node.onCanFrameReceived(frame);
+      frames.pop_front();
+      node.spinSome();
+    }
+  }
+
+
+  CanardMicrosecond now_usec;
+  bool hold_a_to_b;
+  bool hold_b_to_a;
+  std::deque<Frame> a_to_b;
+  std::deque<Frame> b_to_a;
+
+
+private:
+  cyphal::Node::Heap<65536> _heap_a;
+  cyphal::Node::Heap<65536> _heap_b;
+
+  static bool tx(std::deque<Frame> & frames, CanardFrame const & f)
+  {
+    uint8_t const * payload = static_cast<uint8_t const *>(f.payload);
+    frames.push_back(Frame{f.extended_can_id, std::vector<uint8_t>(payload, payload + f.payload_size)});
+    return true;
+  }
+
+
+public:
+  cyphal::Node a;
+  cyphal::Node b;
+};
@@ -0,0 +1,119 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/pnp/AllocationTable.hpp>
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+static AllocationTable::UniqueId makeUniqueId(uint8_t const seed)
+{
+  AllocationTable::UniqueId unique_id{};
+  for (size_t i = 0; i < unique_id.size(); i++)
+    unique_id[i] = static_cast<uint8_t>(seed + i);
+  return unique_id;
+}
+
+TEST_CASE("AllocationTable")
+{
+  AllocationTable table;
+  REQUIRE(0 == table.size());
+
+  SECTION("the same unique-ID is always granted the same node-ID")
+  {
+    auto const node_id = table.allocate(makeUniqueId(1), 10);
+    REQUIRE(node_id.has_value());
+    REQUIRE(10 == node_id.value());
+    REQUIRE(10 == table.allocate(makeUniqueId(1), 50).value());
+    REQUIRE(1 == table.size());
+  }
+
+  SECTION("allocation searches upwards, then downwards, skipping reserved node-IDs")
+  {
+    REQUIRE(table.insert(AllocationTable::UniqueId{}, 125));
+    REQUIRE(124 == table.allocate(makeUniqueId(1), CANARD_NODE_ID_MAX).value());
+    REQUIRE(123 == table.allocate(makeUniqueId(2), 124).value());
+    REQUIRE(table.is_used(125));
+    REQUIRE_FALSE(table.is_used(126));
+  }
+
+  SECTION("mock entries occupy node-IDs but can not be looked up")
+  {
+    REQUIRE(table.insert(AllocationTable::UniqueId{}, 5));
+    REQUIRE(table.insert(AllocationTable::UniqueId{}, 6));
+    REQUIRE_FALSE(table.insert(makeUniqueId(3), 5));
+    REQUIRE_FALSE(table.find(AllocationTable::UniqueId{}).has_value());
+    REQUIRE(7 == table.allocate(makeUniqueId(3), 5).value());
+  }
+
+  SECTION("a full table grants no further node-IDs")
+  {
+    for (uint8_t i = 0; i <= AllocationTable::MAX_ALLOCATABLE_NODE_ID; i++)
+      REQUIRE(table.allocate(makeUniqueId(i), 0).has_value());
+    REQUIRE_FALSE(table.allocate(makeUniqueId(200), 0).has_value());
+    for (uint8_t i = 0; i <= AllocationTable::MAX_ALLOCATABLE_NODE_ID; i++)
+      REQUIRE(table.find(makeUniqueId(i)).has_value());
+  }
+
+  SECTION("serialize/deserialize round trip")
+  {
+    REQUIRE(table.insert(AllocationTable::UniqueId{}, 1));
+    REQUIRE(42 == table.allocate(makeUniqueId(7), 42).value());
+
+    std::array<uint8_t, AllocationTable::SERIALIZED_MAX_SIZE> buf;
+    size_t const size = table.serialize(buf.data(), buf.size());
+    REQUIRE(2 * AllocationTable::SERIALIZED_ENTRY_SIZE == size);
+
+    AllocationTable restored;
+    restored.deserialize(buf.data(), size);
+    REQUIRE(2 == restored.size());
+    REQUIRE(restored.is_used(1));
+    REQUIRE(42 == restored.find(makeUniqueId(7)).value());
+  }
+
+  SECTION("40 clients, most of them preferring the same node-ID, obtain distinct node-IDs")
+  {
+    REQUIRE(table.insert(AllocationTable::UniqueId{}, 1));
+
+    std::array<CanardNodeID, 40> node_ids{};
+    for (uint8_t i = 0; i < node_ids.size(); i++)
+    {
+      CanardNodeID const preferred_node_id = (i % 4) ? CANARD_NODE_ID_MAX : static_cast<CanardNodeID>(i);
+      auto const node_id = table.allocate(makeUniqueId(10 + i), preferred_node_id);
+      REQUIRE(node_id.has_value());
+      REQUIRE(node_id.value() <= AllocationTable::MAX_ALLOCATABLE_NODE_ID);
+      node_ids[i] = node_id.value();
+    }
+
+    std::sort(node_ids.begin(), node_ids.end());
+    REQUIRE(std::adjacent_find(node_ids.cbegin(), node_ids.cend()) == node_ids.cend());
+    REQUIRE(std::find(node_ids.cbegin(), node_ids.cend(), 1) == node_ids.cend());
+
+    /* Repeated requests, e.g. after a restore of the table,
+     * are granted the node-ID allocated before.
+     */
+    std::array<uint8_t, AllocationTable::SERIALIZED_MAX_SIZE> buf;
+    AllocationTable restored;
+    restored.deserialize(buf.data(), table.serialize(buf.data(), buf.size()));
+    for (uint8_t i = 0; i < node_ids.size(); i++)
+      REQUIRE(table.find(makeUniqueId(10 + i)) == restored.allocate(makeUniqueId(10 + i), 0));
+    REQUIRE(41 == restored.size());
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,170 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "NodeLoopback.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using namespace cyphal;
+
+typedef uavcan::node::GetInfo::Request_1_0  GetInfoRequest;
+typedef uavcan::node::GetInfo::Response_1_0 GetInfoResponse;
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("AsyncServiceClient")
+{
+  static CanardMicrosecond constexpr RESPONSE_TIMEOUT_usec = 100*1000UL;
+
+  NodeLoopback loop;
+
+  size_t num_served = 0;
+  auto srv = loop.b.create_service_server<GetInfoRequest, GetInfoResponse>(
+    1000*1000UL,
+    [&num_served](GetInfoRequest const &)
+    {
+      GetInfoResponse rsp;
+      rsp.name.push_back('b');
+      num_served++;
+      return rsp;
+    });
+  auto clt = loop.a.create_async_service_client<GetInfoRequest, GetInfoResponse>(1000*1000UL, RESPONSE_TIMEOUT_usec);
+  REQUIRE(clt);
+
+  coro::FramePool<4096, 2> pool;
+
+  size_t num_resumed = 0;
+  std::vector<std::optional<GetInfoResponse>> responses;
+  auto get_info = [&](coro::FramePoolBase &, CanardNodeID const server_node_id, size_t const num_requests) -> coro::Task
+  {
+    for (size_t i = 0; i < num_requests; i++)
+    {
+      auto rsp = co_await clt->request(server_node_id, GetInfoRequest{});
+      num_resumed++;
+      responses.push_back(std::move(rsp));
+    }
+  };
+
+  SECTION("the coroutine is resumed with each response")
+  {
+    coro::Task task = get_info(pool, NodeLoopback::NODE_ID_B, 3);
+    REQUIRE(task.valid());
+    REQUIRE(!task.done());
+    REQUIRE(num_resumed == 0);
+
+    for (size_t i = 0; (i < 100) && !task.done(); i++)
+      loop.spin();
+
+    REQUIRE(task.done());
+    REQUIRE(num_served == 3);
+    REQUIRE(responses.size() == 3);
+    for (auto const & rsp : responses) {
+      REQUIRE(rsp.has_value());
+      REQUIRE(rsp->name.size() == 1);
+      REQUIRE(rsp->name[0] == 'b');
+    }
+  }
+
+  SECTION("the coroutine is resumed without a response once the response timeout expired")
+  {
+    coro::Task task = get_info(pool, 77, 1);
+    REQUIRE(task.valid());
+
+    loop.spin_for(RESPONSE_TIMEOUT_usec / 2);
+    REQUIRE(num_resumed == 0);
+
+    loop.spin_for(RESPONSE_TIMEOUT_usec);
+    REQUIRE(task.done());
+    REQUIRE(responses.size() == 1);
+    REQUIRE(!responses[0].has_value());
+  }
+
+  SECTION("a response arriving after the timeout does not resume the coroutine again")
+  {
+    loop.hold_b_to_a = true;
+    coro::Task task = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+
+    loop.spin_for(2 * RESPONSE_TIMEOUT_usec);
+    REQUIRE(task.done());
+    REQUIRE(num_served == 1);
+    REQUIRE(!responses.at(0).has_value());
+
+    loop.hold_b_to_a = false;
+    loop.spin();
+    REQUIRE(num_resumed == 1);
+  }
+
+  SECTION("no coroutine is started once the frame pool is exhausted")
+  {
+    coro::Task t1 = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+    coro::Task t2 = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+    REQUIRE(t1.valid());
+    REQUIRE(t2.valid());
+    REQUIRE(pool.available() == 0);
+
+    coro::Task t3 = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+    REQUIRE(!t3.valid());
+    REQUIRE(!t3.done());
+
+    for (size_t i = 0; (i < 100) && !(t1.done() && t2.done()); i++)
+      loop.spin();
+    REQUIRE(responses.size() == 2);
+
+    /* The frame is only released once the task is destroyed. */
+    REQUIRE(pool.available() == 0);
+    t1 = coro::Task{};
+    REQUIRE(pool.available() == 1);
+    coro::Task t4 = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+    REQUIRE(t4.valid());
+  }
+
+  SECTION("destroying a suspended task releases its frame and its pending request")
+  {
+    {
+      coro::Task task = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+      REQUIRE(task.valid());
+      REQUIRE(pool.available() == 1);
+    }
+    REQUIRE(pool.available() == 2);
+
+    for (size_t i = 0; i < 100; i++)
+      loop.spin();
+    REQUIRE(num_served == 1);
+    REQUIRE(num_resumed == 0);
+
+    /* The slot of the pending request is available again. */
+    std::vector<coro::Task> tasks;
+    for (size_t i = 0; i < 2; i++)
+      tasks.push_back(get_info(pool, NodeLoopback::NODE_ID_B, 1));
+    for (size_t i = 0; i < 100; i++)
+      loop.spin();
+    REQUIRE(responses.size() == 2);
+    REQUIRE(responses[0].has_value());
+    REQUIRE(responses[1].has_value());
+  }
+
+  SECTION("a coroutine awaiting a response of a destroyed client is never resumed")
+  {
+    coro::Task task = get_info(pool, NodeLoopback::NODE_ID_B, 1);
+    clt.reset();
+    loop.spin_for(2 * RESPONSE_TIMEOUT_usec);
+    REQUIRE(!task.done());
+    REQUIRE(num_resumed == 0);
+  }
+}
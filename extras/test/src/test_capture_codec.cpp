@@ -0,0 +1,104 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/capture/CaptureCodec.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+static CaptureRecord makeRecord(CanardMicrosecond const timestamp_usec, bool const is_tx, uint32_t const extended_can_id, size_t const payload_size)
+{
+  CaptureRecord record{};
+  record.timestamp_usec  = timestamp_usec;
+  record.is_tx           = is_tx;
+  record.extended_can_id = extended_can_id;
+  record.payload_size    = payload_size;
+  for (size_t i = 0; i < payload_size; i++)
+    record.payload[i] = static_cast<uint8_t>(i + 1);
+  return record;
+}
+
+static void requireEqual(CaptureRecord const & lhs, CaptureRecord const & rhs)
+{
+  REQUIRE(lhs.timestamp_usec  == rhs.timestamp_usec);
+  REQUIRE(lhs.is_tx           == rhs.is_tx);
+  REQUIRE(lhs.extended_can_id == rhs.extended_can_id);
+  REQUIRE(lhs.payload_size    == rhs.payload_size);
+  REQUIRE(std::equal(lhs.payload.cbegin(), lhs.payload.cbegin() + lhs.payload_size, rhs.payload.cbegin()));
+}
+
+TEST_CASE("CaptureCodec")
+{
+  std::array<uint8_t, CaptureCodec::MAX_RECORD_SIZE> buf{};
+
+  SECTION("the header is recognized")
+  {
+    REQUIRE(CaptureCodec::encodeHeader(buf.data()) == CaptureCodec::HEADER_SIZE);
+    REQUIRE(CaptureCodec::decodeHeader(buf.data(), CaptureCodec::HEADER_SIZE));
+    REQUIRE_FALSE(CaptureCodec::decodeHeader(buf.data(), CaptureCodec::HEADER_SIZE - 1));
+    buf[0] = 'X';
+    REQUIRE_FALSE(CaptureCodec::decodeHeader(buf.data(), CaptureCodec::HEADER_SIZE));
+  }
+
+  SECTION("records are decoded as encoded")
+  {
+    CaptureRecord const record = makeRecord(1000250, true, 0x107D552A, 8);
+    size_t const size = CaptureCodec::encodeRecord(buf.data(), record, 1000000);
+
+    auto const decoded = CaptureCodec::decodeRecord(buf.data(), size, 1000000);
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->second == size);
+    requireEqual(decoded->first, record);
+  }
+
+  SECTION("small timestamp differences are encoded compactly")
+  {
+    /* flags + 2 byte delta + CAN-ID + length + data */
+    REQUIRE(CaptureCodec::encodeRecord(buf.data(), makeRecord(1000250, false, 0x107D552A, 8), 1000000) == (1 + 2 + 4 + 1 + 8));
+  }
+
+  SECTION("decreasing timestamps and CAN FD frames are supported")
+  {
+    CaptureRecord const record = makeRecord(999000, false, 0x1FFFFFFF, CANARD_MTU_CAN_FD);
+    size_t const size = CaptureCodec::encodeRecord(buf.data(), record, 1000000);
+
+    auto const decoded = CaptureCodec::decodeRecord(buf.data(), size, 1000000);
+    REQUIRE(decoded.has_value());
+    requireEqual(decoded->first, record);
+  }
+
+  SECTION("the largest timestamp difference fits into a record")
+  {
+    CaptureRecord const record = makeRecord(UINT64_MAX / 2, false, 0, CANARD_MTU_CAN_FD);
+    size_t const size = CaptureCodec::encodeRecord(buf.data(), record, 0);
+    REQUIRE(size <= CaptureCodec::MAX_RECORD_SIZE);
+
+    auto const decoded = CaptureCodec::decodeRecord(buf.data(), size, 0);
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->first.timestamp_usec == record.timestamp_usec);
+  }
+
+  SECTION("incomplete records are rejected")
+  {
+    size_t const size = CaptureCodec::encodeRecord(buf.data(), makeRecord(1000250, false, 0x107D552A, 8), 1000000);
+    for (size_t s = 0; s < size; s++)
+      REQUIRE_FALSE(CaptureCodec::decodeRecord(buf.data(), s, 1000000).has_value());
+  }
+}
+
+} /* cyphal::impl */
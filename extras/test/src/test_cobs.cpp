@@ -0,0 +1,164 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/transport/serial/Cobs.hpp>
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+/**************************************************************************************
+ * HELPER
+ **************************************************************************************/
+
+namespace
+{
+
+std::vector<uint8_t> encode(std::vector<uint8_t> const & data)
+{
+  std::vector<uint8_t> buf(cyphal::impl::CobsEncoder::maxEncodedSize(data.size()));
+  cyphal::impl::CobsEncoder encoder(buf.data());
+  encoder.add(data.data(), data.size());
+  buf.resize(encoder.finish());
+  return buf;
+}
+
+/* Decodes a byte stream, returning all completed frames. */
+std::vector<std::vector<uint8_t>> decode(std::vector<uint8_t> const & stream, size_t const capacity)
+{
+  std::vector<uint8_t> buf(capacity);
+  cyphal::impl::CobsDecoder decoder(buf.data(), buf.size());
+  std::vector<std::vector<uint8_t>> frames;
+  for (auto const byte : stream)
+    if (decoder.decode(byte))
+      frames.emplace_back(decoder.data(), decoder.data() + decoder.size());
+  return frames;
+}
+
+std::vector<uint8_t> delimit(std::vector<uint8_t> const & encoded)
+{
+  std::vector<uint8_t> stream{0};
+  stream.insert(stream.end(), encoded.begin(), encoded.end());
+  stream.push_back(0);
+  return stream;
+}
+
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("CobsEncoder")
+{
+  SECTION("zero bytes are replaced")
+  {
+    REQUIRE(encode({0x00})                   == std::vector<uint8_t>{0x01, 0x01});
+    REQUIRE(encode({0x00, 0x00})             == std::vector<uint8_t>{0x01, 0x01, 0x01});
+    REQUIRE(encode({0x11, 0x22, 0x00, 0x33}) == std::vector<uint8_t>{0x03, 0x11, 0x22, 0x02, 0x33});
+    REQUIRE(encode({0x11, 0x00, 0x00, 0x00}) == std::vector<uint8_t>{0x02, 0x11, 0x01, 0x01, 0x01});
+  }
+
+  SECTION("a run of 254 non-zero bytes is a single block")
+  {
+    std::vector<uint8_t> data(254);
+    for (size_t i = 0; i < data.size(); i++)
+      data[i] = static_cast<uint8_t>(i + 1);
+
+    auto const encoded = encode(data);
+    REQUIRE(encoded.size() == 256);
+    REQUIRE(encoded[0] == 0xFF);
+    REQUIRE(encoded[255] == 0x01);
+  }
+
+  SECTION("data added in chunks is encoded as a whole")
+  {
+    std::vector<uint8_t> const data{0x11, 0x00, 0x22, 0x33, 0x00, 0x44};
+    std::vector<uint8_t> buf(CobsEncoder::maxEncodedSize(data.size()));
+    CobsEncoder encoder(buf.data());
+    encoder.add(data.data(), 3);
+    encoder.add(data.data() + 3, 0);
+    encoder.add(data.data() + 3, 3);
+    buf.resize(encoder.finish());
+    REQUIRE(buf == encode(data));
+  }
+
+  SECTION("encoded data never contains a zero byte")
+  {
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++)
+      data[i] = static_cast<uint8_t>((i % 300 < 280) ? (i % 255) + 1 : 0);
+
+    auto const encoded = encode(data);
+    REQUIRE(encoded.size() <= CobsEncoder::maxEncodedSize(data.size()));
+    for (auto const byte : encoded)
+      REQUIRE(byte != 0);
+  }
+}
+
+TEST_CASE("CobsDecoder")
+{
+  SECTION("roundtrip")
+  {
+    for (size_t size : {1, 2, 253, 254, 255, 508, 509, 1000})
+    {
+      std::vector<uint8_t> data(size);
+      for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>((i % 7) ? i : 0);
+
+      auto const frames = decode(delimit(encode(data)), 1024);
+      REQUIRE(frames.size() == 1);
+      REQUIRE(frames[0] == data);
+    }
+  }
+
+  SECTION("consecutive frames sharing delimiters")
+  {
+    std::vector<uint8_t> const a{0x01, 0x00, 0x02};
+    std::vector<uint8_t> const b{0x00};
+    std::vector<uint8_t> stream = delimit(encode(a));
+    auto const encoded_b = encode(b);
+    stream.insert(stream.end(), encoded_b.begin(), encoded_b.end());
+    stream.push_back(0);
+    stream.push_back(0);
+
+    auto const frames = decode(stream, 16);
+    REQUIRE(frames.size() == 2);
+    REQUIRE(frames[0] == a);
+    REQUIRE(frames[1] == b);
+  }
+
+  SECTION("frames exceeding the capacity are discarded")
+  {
+    std::vector<uint8_t> const large(17, 0x55);
+    std::vector<uint8_t> const small{0x01, 0x02};
+    std::vector<uint8_t> stream = delimit(encode(large));
+    auto const second = delimit(encode(small));
+    stream.insert(stream.end(), second.begin(), second.end());
+
+    auto const frames = decode(stream, 16);
+    REQUIRE(frames.size() == 1);
+    REQUIRE(frames[0] == small);
+  }
+
+  SECTION("truncated frames are discarded")
+  {
+    std::vector<uint8_t> const stream{0x00, 0x05, 0x11, 0x22, 0x00, 0x03, 0x11, 0x22, 0x00};
+
+    auto const frames = decode(stream, 16);
+    REQUIRE(frames.size() == 1);
+    REQUIRE(frames[0] == std::vector<uint8_t>{0x11, 0x22});
+  }
+}
+
+} /* cyphal::impl */
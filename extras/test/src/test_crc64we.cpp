@@ -0,0 +1,38 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/pnp/crc64we.hpp>
+#include <catch2/catch.hpp>
+
+#include <string>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("crc64we")
+{
+  SECTION("check value")
+  {
+    std::string const check = "123456789";
+    REQUIRE(0x62EC59E3F1A4F00AULL == crc64we(reinterpret_cast<uint8_t const *>(check.data()), check.size()));
+  }
+
+  SECTION("empty input")
+  {
+    REQUIRE(0ULL == crc64we(nullptr, 0));
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,149 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/queue/DispatchQueue.hpp>
+#include <catch2/catch.hpp>
+
+#include <cstdlib>
+#include <vector>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+namespace
+{
+
+size_t num_allocations = 0;
+
+void * test_allocate(CanardInstance * const, size_t const amount)
+{
+  num_allocations++;
+  return std::malloc(amount);
+}
+
+void test_free(CanardInstance * const, void * const pointer)
+{
+  if (pointer)
+    num_allocations--;
+  std::free(pointer);
+}
+
+class RecordingSubscription final : public SubscriptionBase
+{
+public:
+  RecordingSubscription() : SubscriptionBase{CanardTransferKindMessage} { }
+
+  std::vector<uint8_t> received;
+
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    received.push_back(*static_cast<uint8_t const *>(transfer.payload));
+    return true;
+  }
+};
+
+CanardRxTransfer makeTransfer(uint8_t & payload, CanardPriority const priority, CanardPortID const port_id = 1)
+{
+  CanardRxTransfer transfer{};
+  transfer.metadata.priority      = priority;
+  transfer.metadata.transfer_kind = CanardTransferKindMessage;
+  transfer.metadata.port_id       = port_id;
+  transfer.payload_size           = 1;
+  transfer.payload                = &payload;
+  return transfer;
+}
+
+}
+
+TEST_CASE("DispatchQueue")
+{
+  CanardInstance canard_hdl{};
+  canard_hdl.memory_allocate = test_allocate;
+  canard_hdl.memory_free     = test_free;
+  num_allocations = 0;
+
+  RecordingSubscription sub;
+  CanardMicrosecond now = 0;
+  auto const micros = [&now]() { return now; };
+
+  {
+    DispatchQueue queue(canard_hdl, 4);
+
+    SECTION("transfers are dispatched by priority, in order of reception within the same priority")
+    {
+      uint8_t payload[] = {1, 2, 3, 4};
+      queue.pushCopy(sub, makeTransfer(payload[0], CanardPriorityNominal));
+      queue.pushCopy(sub, makeTransfer(payload[1], CanardPriorityHigh));
+      queue.pushCopy(sub, makeTransfer(payload[2], CanardPriorityNominal));
+      queue.pushCopy(sub, makeTransfer(payload[3], CanardPriorityExceptional));
+
+      REQUIRE(queue.process(micros, 1000) == 4);
+      REQUIRE(sub.received == std::vector<uint8_t>{4, 2, 1, 3});
+      REQUIRE(num_allocations == 0);
+    }
+
+    SECTION("at least one transfer is dispatched once the budget is exhausted")
+    {
+      uint8_t payload[] = {1, 2};
+      queue.pushCopy(sub, makeTransfer(payload[0], CanardPriorityNominal));
+      queue.pushCopy(sub, makeTransfer(payload[1], CanardPriorityNominal));
+
+      auto const slow_micros = [&now]() { return now += 10; };
+      REQUIRE(queue.process(slow_micros, 5) == 1);
+      REQUIRE(queue.size() == 1);
+      REQUIRE(queue.process(slow_micros, 5) == 1);
+      REQUIRE(sub.received == std::vector<uint8_t>{1, 2});
+    }
+
+    SECTION("a full queue drops the transfer of the lowest priority")
+    {
+      uint8_t payload[] = {1, 2, 3, 4, 5, 6};
+      for (size_t i = 0; i < 4; i++)
+        queue.pushCopy(sub, makeTransfer(payload[i], CanardPriorityNominal));
+
+      queue.pushCopy(sub, makeTransfer(payload[4], CanardPriorityLow));
+      REQUIRE(queue.dropped() == 1);
+      queue.pushCopy(sub, makeTransfer(payload[5], CanardPriorityHigh));
+      REQUIRE(queue.dropped() == 2);
+      REQUIRE(num_allocations == 4);
+
+      REQUIRE(queue.process(micros, 1000) == 4);
+      REQUIRE(sub.received == std::vector<uint8_t>{6, 1, 2, 3});
+    }
+
+    SECTION("discarded transfers are never dispatched")
+    {
+      uint8_t payload[] = {1, 2};
+      queue.pushCopy(sub, makeTransfer(payload[0], CanardPriorityNominal, 1));
+      queue.pushCopy(sub, makeTransfer(payload[1], CanardPriorityNominal, 2));
+
+      queue.discard(CanardTransferKindMessage, 1);
+      REQUIRE(num_allocations == 1);
+      REQUIRE(queue.process(micros, 1000) == 1);
+      REQUIRE(sub.received == std::vector<uint8_t>{2});
+    }
+
+    SECTION("pending transfers are freed along with the queue")
+    {
+      uint8_t payload = 1;
+      queue.pushCopy(sub, makeTransfer(payload, CanardPriorityNominal));
+      REQUIRE(num_allocations == 1);
+    }
+  }
+
+  REQUIRE(num_allocations == 0);
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,56 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/time/DriftCompensatedClock.hpp>
+#include <catch2/catch.hpp>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("DriftCompensatedClock")
+{
+  DriftCompensatedClock clock;
+  REQUIRE_FALSE(clock.is_valid());
+
+  SECTION("a single sample compensates the offset")
+  {
+    clock.update(1000, 5000);
+    REQUIRE(clock.is_valid());
+    REQUIRE(5500 == clock.convert(1500));
+  }
+
+  SECTION("the rate ratio is estimated from consecutive samples")
+  {
+    /* Reference clock runs 200 ppm faster than the local one. */
+    for (uint64_t local = 1000000; local <= 10000000; local += 1000000)
+      clock.update(local, 777000000 + (local * 10002) / 10000);
+
+    REQUIRE(Approx(1.0002).epsilon(1e-9) == clock.rate());
+    uint64_t const local = 10500000;
+    int64_t const error = static_cast<int64_t>(clock.convert(local) - (777000000 + (local * 10002) / 10000));
+    REQUIRE(std::abs(error) <= 1);
+  }
+
+  SECTION("a leap of the reference clock restarts the estimation")
+  {
+    clock.update(1000000, 2000000);
+    clock.update(2000000, 3000100);
+    clock.update(3000000, 9000000);
+    REQUIRE(1.0 == clock.rate());
+    REQUIRE(9000000 == clock.convert(3000000));
+  }
+}
+
+} /* cyphal::impl */
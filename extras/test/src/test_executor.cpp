@@ -0,0 +1,118 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/executor/ExecutorBase.hpp>
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+namespace
+{
+
+class RecordingSubscription final : public SubscriptionBase
+{
+public:
+  RecordingSubscription() : SubscriptionBase{CanardTransferKindMessage} { }
+
+  std::vector<std::vector<uint8_t>> executed;
+
+  virtual bool onTransferReceived(CanardRxTransfer const &) override { return true; }
+  virtual bool onTransferExecuted(CanardRxTransfer const & transfer) override
+  {
+    uint8_t const * payload = static_cast<uint8_t const *>(transfer.payload);
+    executed.emplace_back(payload, payload + transfer.payload_size);
+    return true;
+  }
+};
+
+CanardRxTransfer makeTransfer(std::vector<uint8_t> & payload)
+{
+  CanardRxTransfer transfer{};
+  transfer.payload_size = payload.size();
+  transfer.payload = payload.data();
+  return transfer;
+}
+
+}
+
+TEST_CASE("ExecutorBase")
+{
+  ExecutorBase executor;
+  RecordingSubscription sub;
+
+  SECTION("posted transfers are executed in order with a copy of their payload")
+  {
+    std::vector<uint8_t> a{1, 2, 3}, b{4};
+    REQUIRE(executor.post(sub, makeTransfer(a)));
+    REQUIRE(executor.post(sub, makeTransfer(b)));
+    a[0] = 0xFF;
+
+    REQUIRE(sub.executed.empty());
+    REQUIRE(executor.spinSome() == 2);
+    REQUIRE(sub.executed == std::vector<std::vector<uint8_t>>{{1, 2, 3}, {4}});
+    REQUIRE(executor.spinSome() == 0);
+  }
+
+  SECTION("transfers are dropped while all slots are in use")
+  {
+    std::vector<uint8_t> payload{1};
+    for (size_t i = 0; i < ExecutorBase::QUEUE_CAPACITY; i++)
+      REQUIRE(executor.post(sub, makeTransfer(payload)));
+    REQUIRE_FALSE(executor.post(sub, makeTransfer(payload)));
+    REQUIRE(executor.dropped() == 1);
+
+    REQUIRE(executor.spinSome() == ExecutorBase::QUEUE_CAPACITY);
+    REQUIRE(executor.post(sub, makeTransfer(payload)));
+  }
+
+  SECTION("pending transfers of a cancelled subscription are discarded")
+  {
+    RecordingSubscription other;
+    std::vector<uint8_t> payload{1};
+    REQUIRE(executor.post(sub, makeTransfer(payload)));
+    REQUIRE(executor.post(other, makeTransfer(payload)));
+
+    executor.cancel(sub);
+    REQUIRE(executor.spinSome() == 1);
+    REQUIRE(sub.executed.empty());
+    REQUIRE(other.executed.size() == 1);
+  }
+
+  SECTION("transfers are executed by a worker thread")
+  {
+    size_t constexpr NUM_TRANSFERS = 10000;
+    std::atomic<bool> is_done{false};
+    std::thread worker([&]() { while (!is_done) executor.spinSome(); executor.spinSome(); });
+
+    size_t num_posted = 0;
+    for (size_t i = 0; i < NUM_TRANSFERS; i++)
+    {
+      std::vector<uint8_t> payload{static_cast<uint8_t>(i)};
+      if (executor.post(sub, makeTransfer(payload)))
+        num_posted++;
+    }
+    is_done = true;
+    worker.join();
+
+    REQUIRE(sub.executed.size() == num_posted);
+    REQUIRE(num_posted + executor.dropped() == NUM_TRANSFERS);
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,164 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "NodeLoopback.hpp"
+
+#include <util/file/FileReadClient.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <deque>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using namespace cyphal;
+using namespace cyphal::support::platform::file;
+
+/**************************************************************************************
+ * HELPER
+ **************************************************************************************/
+
+class MemoryFileSource : public interface::FileSource
+{
+public:
+  explicit MemoryFileSource(std::vector<uint8_t> const & content) : _content{content} { }
+
+  [[nodiscard]] virtual auto read(const std::string_view,
+                                  const std::uint64_t offset,
+                                  const std::size_t size,
+                                  void* const data) -> std::variant<Error, std::size_t> override
+  {
+    if (offset >= _content.size())
+      return static_cast<size_t>(0);
+    size_t const len = std::min<size_t>(size, _content.size() - offset);
+    std::memcpy(data, _content.data() + offset, len);
+    return len;
+  }
+
+private:
+  std::vector<uint8_t> const & _content;
+};
+
+class MemoryFileSink : public interface::FileSink
+{
+public:
+  [[nodiscard]] virtual auto write(const void* const data, const std::size_t size) -> std::optional<Error> override
+  {
+    uint8_t const * bytes = static_cast<uint8_t const *>(data);
+    content.insert(content.end(), bytes, bytes + size);
+    return std::nullopt;
+  }
+
+  std::vector<uint8_t> content;
+};
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("FileReadClient")
+{
+  static size_t constexpr WINDOW_SIZE = 8;
+  static CanardMicrosecond constexpr RESPONSE_TIMEOUT_usec = impl::FileReadClient::RESPONSE_TIMEOUT_usec;
+
+  /* 64 chunks, i.e. twice the transfer-ID space, plus a short one. */
+  std::vector<uint8_t> file(64 * 256 + 100);
+  for (size_t i = 0; i < file.size(); i++)
+    file[i] = static_cast<uint8_t>((i * 7) ^ (i >> 8));
+
+  NodeLoopback loop;
+  MemoryFileSource file_source(file);
+  MemoryFileSink file_sink;
+
+  auto srv = loop.b.create_file_server(file_source);
+  auto clt = loop.a.create_file_read_client(NodeLoopback::NODE_ID_B, "image.bin", file_sink, WINDOW_SIZE);
+  REQUIRE(srv);
+  REQUIRE(clt);
+
+  auto spin_until_done = [&](CanardMicrosecond const max_duration_usec)
+  {
+    for (CanardMicrosecond t = 0; (t < max_duration_usec) && (clt->status() == impl::FileReadClientBase::Status::InProgress); t += 1000)
+      loop.spin();
+  };
+
+  SECTION("the file is downloaded in order")
+  {
+    spin_until_done(10*1000*1000UL);
+    REQUIRE(clt->status() == impl::FileReadClientBase::Status::Done);
+    REQUIRE(clt->offset() == file.size());
+    REQUIRE((file_sink.content == file));
+  }
+
+  SECTION("a late response to a retried request is not mistaken for a response to a newer request")
+  {
+    /* The responses to the first window of requests are delayed
+     * beyond the response timeout, hence all requests are retried.
+     */
+    loop.hold_b_to_a = true;
+    loop.spin_for(100*1000UL);
+    std::deque<NodeLoopback::Frame> const late_responses = loop.b_to_a;
+    REQUIRE(!late_responses.empty());
+    loop.b_to_a.clear();
+    loop.hold_b_to_a = false;
+
+    /* The late responses arrive once more requests than there are
+     * transfer-IDs have been sent, including the retries.
+     */
+    for (CanardMicrosecond t = 0; (t < 2 * RESPONSE_TIMEOUT_usec) && (clt->offset() < 3 * WINDOW_SIZE * 256); t += 1000)
+      loop.spin();
+    REQUIRE(clt->offset() >= 3 * WINDOW_SIZE * 256);
+    REQUIRE(clt->offset() < file.size());
+
+    std::deque<NodeLoopback::Frame> replay = late_responses;
+    NodeLoopback::deliver(replay, loop.a);
+
+    spin_until_done(10*1000*1000UL);
+    REQUIRE(clt->status() == impl::FileReadClientBase::Status::Done);
+    REQUIRE(file_sink.content.size() == file.size());
+    REQUIRE((file_sink.content == file));
+  }
+}
+
+TEST_CASE("FileReadClient retries after a lost response")
+{
+  static CanardMicrosecond constexpr RESPONSE_TIMEOUT_usec = impl::FileReadClient::RESPONSE_TIMEOUT_usec;
+
+  std::vector<uint8_t> file(3 * 256);
+  for (size_t i = 0; i < file.size(); i++)
+    file[i] = static_cast<uint8_t>(i);
+
+  NodeLoopback loop;
+  MemoryFileSource file_source(file);
+  MemoryFileSink file_sink;
+
+  auto srv = loop.b.create_file_server(file_source);
+  auto clt = loop.a.create_file_read_client(NodeLoopback::NODE_ID_B, "image.bin", file_sink, 1);
+
+  /* The server receives the first request, but its response is lost. */
+  loop.hold_b_to_a = true;
+  for (size_t i = 0; (i < 100) && loop.b_to_a.empty(); i++)
+    loop.spin();
+  REQUIRE(!loop.b_to_a.empty());
+  loop.b_to_a.clear();
+  loop.hold_b_to_a = false;
+
+  /* The first retry, well within the transfer-ID timeout of the
+   * server, is not mistaken for a duplicate of the lost request.
+   */
+  loop.spin_for(RESPONSE_TIMEOUT_usec + 100*1000UL);
+  REQUIRE(clt->status() == impl::FileReadClientBase::Status::Done);
+  REQUIRE((file_sink.content == file));
+}
@@ -0,0 +1,67 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/coro/FramePool.hpp>
+#include <catch2/catch.hpp>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::coro
+{
+
+TEST_CASE("FramePool")
+{
+  FramePool<128, 2> pool;
+  REQUIRE(pool.available() == 2);
+
+  SECTION("frames are allocated until the pool is exhausted")
+  {
+    void * a = pool.allocate(100);
+    void * b = pool.allocate(128);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(pool.available() == 0);
+    REQUIRE(pool.allocate(1) == nullptr);
+
+    FramePoolBase::deallocate(a);
+    REQUIRE(pool.available() == 1);
+    REQUIRE(pool.allocate(1) == a);
+  }
+
+  SECTION("frames larger than the frame size are refused")
+  {
+    REQUIRE(pool.allocate(129) == nullptr);
+    REQUIRE(pool.available() == 2);
+  }
+
+  SECTION("frames are suitably aligned")
+  {
+    void * a = pool.allocate(8);
+    REQUIRE((reinterpret_cast<uintptr_t>(a) % alignof(std::max_align_t)) == 0);
+  }
+
+  SECTION("frames are returned to the pool they were allocated from")
+  {
+    FramePool<64, 1> other;
+    void * a = other.allocate(8);
+    void * b = pool.allocate(8);
+    FramePoolBase::deallocate(a);
+    REQUIRE(other.available() == 1);
+    REQUIRE(pool.available() == 1);
+    FramePoolBase::deallocate(b);
+    REQUIRE(pool.available() == 2);
+  }
+}
+
+} /* cyphal::coro */
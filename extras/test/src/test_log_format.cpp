@@ -0,0 +1,78 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/log/LogFormat.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+template<typename... Args>
+static std::string format(size_t const buf_size, char const * fmt, Args const... args)
+{
+  std::array<LogArg, sizeof...(Args) + 1> const log_args{toLogArg(args)...};
+  std::string buf(buf_size, 'X');
+  size_t const len = formatLog(buf.data(), buf.size(), fmt, log_args.data(), sizeof...(Args));
+  REQUIRE(buf[len] == '\0');
+  return buf.substr(0, len);
+}
+
+TEST_CASE("formatLog")
+{
+  SECTION("plain text")
+  {
+    REQUIRE(format(64, "hello world") == "hello world");
+    REQUIRE(format(64, "100%%") == "100%");
+  }
+
+  SECTION("integers of any width and signedness")
+  {
+    REQUIRE(format(64, "%d %i %u", int8_t{-5}, -70000L, uint16_t{65535}) == "-5 -70000 65535");
+    REQUIRE(format(64, "%llu", uint64_t{18446744073709551615ULL}) == "18446744073709551615");
+    REQUIRE(format(64, "%04x|%-3d|%+d", 0xABu, 7, 3) == "00ab|7  |+3");
+  }
+
+  SECTION("floating point, characters, strings and booleans")
+  {
+    REQUIRE(format(64, "%.2f %c %s %d", 3.14159f, 'A', "motor", true) == "3.14 A motor 1");
+  }
+
+  SECTION("length modifiers are ignored")
+  {
+    REQUIRE(format(64, "%ld %hhu %zu %lf", 1, 2u, size_t{3}, 0.5) == "1 2 3 0.500000");
+  }
+
+  SECTION("missing arguments produce no output")
+  {
+    REQUIRE(format(64, "a=%d b=%d", 1) == "a=1 b=");
+  }
+
+  SECTION("mismatched string arguments are not dereferenced")
+  {
+    REQUIRE(format(64, "%s", 42) == "(?)");
+  }
+
+  SECTION("output is truncated to the buffer size")
+  {
+    REQUIRE(format(8, "%s", "0123456789") == "0123456");
+    REQUIRE(format(8, "abc%d", 123456789) == "abc1234");
+    REQUIRE(format(4, "abcdef") == "abc");
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,194 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/view/PortListView.hpp>
+#include <util/view/RegisterAccessResponseView.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+TEST_CASE("PortListView")
+{
+  uavcan::node::port::List_1_0 list;
+  list.publishers.set_sparse_list();
+  list.publishers.get_sparse_list().push_back(uavcan::node::port::SubjectID_1_0{10});
+  list.publishers.get_sparse_list().push_back(uavcan::node::port::SubjectID_1_0{7509});
+  list.subscribers.set_mask();
+  list.subscribers.get_mask()[3]    = true;
+  list.subscribers.get_mask()[8191] = true;
+  list.clients.mask[430] = true;
+  list.servers.mask[384] = true;
+
+  std::array<uint8_t, uavcan::node::port::List_1_0::_traits_::SerializationBufferSizeBytes> buf{};
+  nunavut::support::bitspan buf_bitspan{buf};
+  auto const rc = serialize(list, buf_bitspan);
+  REQUIRE(rc);
+
+  PortListView const view(buf.data(), *rc);
+
+  SECTION("sections are located via their delimiter headers")
+  {
+    REQUIRE(view.valid());
+
+    REQUIRE(view.publishers().is_sparse_list());
+    REQUIRE(view.publishers().sparse_list_size() == 2);
+    REQUIRE(view.publishers().sparse_list_at(1) == 7509);
+    REQUIRE(view.publishers().contains(10));
+    REQUIRE(view.publishers().contains(7509));
+    REQUIRE(!view.publishers().contains(11));
+
+    REQUIRE(view.subscribers().is_mask());
+    REQUIRE(view.subscribers().contains(3));
+    REQUIRE(view.subscribers().contains(8191));
+    REQUIRE(!view.subscribers().contains(4));
+    REQUIRE(!view.subscribers().contains(8192));
+
+    REQUIRE(view.clients().contains(430));
+    REQUIRE(!view.clients().contains(384));
+    REQUIRE(view.servers().contains(384));
+    REQUIRE(!view.servers().contains(512));
+  }
+
+  SECTION("a total subject list contains every subject")
+  {
+    list.publishers.set_total();
+    nunavut::support::bitspan total_bitspan{buf};
+    auto const total_rc = serialize(list, total_bitspan);
+    REQUIRE(total_rc);
+
+    PortListView const total_view(buf.data(), *total_rc);
+    REQUIRE(total_view.publishers().is_total());
+    REQUIRE(total_view.publishers().contains(1234));
+    REQUIRE(total_view.subscribers().contains(8191));
+  }
+
+  SECTION("a truncated payload is not valid and reads as empty")
+  {
+    PortListView const truncated(buf.data(), 12);
+    REQUIRE(!truncated.valid());
+    REQUIRE(truncated.publishers().contains(10));
+    REQUIRE(!truncated.subscribers().contains(3));
+    REQUIRE(!truncated.servers().contains(384));
+  }
+
+  SECTION("the view may be decoded into the message")
+  {
+    auto const msg = view.decode();
+    REQUIRE(msg.has_value());
+    REQUIRE(msg->subscribers.get_mask()[8191]);
+    REQUIRE(msg->servers.mask[384]);
+  }
+}
+
+TEST_CASE("RegisterAccessResponseView")
+{
+  uavcan::_register::Access::Response_1_0 rsp;
+  rsp.timestamp.microsecond = 0x00123456789ABCDEULL;
+  rsp._mutable   = false;
+  rsp.persistent = true;
+
+  std::array<uint8_t, uavcan::_register::Access::Response_1_0::_traits_::SerializationBufferSizeBytes> buf{};
+
+  auto serialize_rsp = [&]()
+  {
+    nunavut::support::bitspan buf_bitspan{buf};
+    auto const rc = serialize(rsp, buf_bitspan);
+    REQUIRE(rc);
+    return RegisterAccessResponseView(buf.data(), *rc);
+  };
+
+  SECTION("fixed layout prefix")
+  {
+    rsp.value.set_empty();
+    auto const view = serialize_rsp();
+    REQUIRE(view.timestamp_usec() == 0x00123456789ABCDEULL);
+    REQUIRE(!view.is_mutable());
+    REQUIRE(view.is_persistent());
+    REQUIRE(view.value().is_empty());
+    REQUIRE(view.value().size() == 0);
+  }
+
+  SECTION("string value")
+  {
+    auto & str = rsp.value.set_string();
+    for (char const c : std::string_view("cyphal.node.name"))
+      str.value.push_back(static_cast<uint8_t>(c));
+    auto const view = serialize_rsp();
+    REQUIRE(view.value().is_string());
+    REQUIRE(view.value().string() == "cyphal.node.name");
+  }
+
+  SECTION("natural16 value")
+  {
+    auto & nat = rsp.value.set_natural16();
+    nat.value.push_back(1);
+    nat.value.push_back(65535);
+    auto const view = serialize_rsp();
+    REQUIRE(view.value().is_natural());
+    REQUIRE(view.value().size() == 2);
+    REQUIRE(view.value().natural(0) == 1);
+    REQUIRE(view.value().natural(1) == 65535);
+    REQUIRE(view.value().natural(2) == 0);
+    REQUIRE(view.value().integer(0) == 0);
+  }
+
+  SECTION("integer8 value")
+  {
+    auto & i8 = rsp.value.set_integer8();
+    i8.value.push_back(-128);
+    i8.value.push_back(127);
+    auto const view = serialize_rsp();
+    REQUIRE(view.value().is_integer());
+    REQUIRE(view.value().integer(0) == -128);
+    REQUIRE(view.value().integer(1) == 127);
+  }
+
+  SECTION("real32 value")
+  {
+    auto & r32 = rsp.value.set_real32();
+    r32.value.push_back(1.5f);
+    r32.value.push_back(-0.25f);
+    auto const view = serialize_rsp();
+    REQUIRE(view.value().is_real());
+    REQUIRE(view.value().real(1) == -0.25);
+  }
+
+  SECTION("bit value")
+  {
+    auto & b = rsp.value.set_bit();
+    b.value.push_back(false);
+    b.value.push_back(true);
+    auto const view = serialize_rsp();
+    REQUIRE(view.value().is_bit());
+    REQUIRE(view.value().size() == 2);
+    REQUIRE(!view.value().bit(0));
+    REQUIRE(view.value().bit(1));
+  }
+
+  SECTION("a payload truncated within the prefix")
+  {
+    rsp.value.set_natural8().value.push_back(42);
+    serialize_rsp();
+    RegisterAccessResponseView const view(buf.data(), 7);
+    REQUIRE(view.timestamp_usec() == 0x00123456789ABCDEULL);
+    REQUIRE(!view.is_persistent());
+    REQUIRE(view.value().is_empty());
+  }
+}
+
+} /* ns */
@@ -0,0 +1,111 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/bridge/MetatransportCanCodec.hpp>
+#include <DSDL_Types/uavcan/metatransport/can.h>
+#include <catch2/catch.hpp>
+
+#include <array>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("MetatransportCanCodec")
+{
+  typedef uavcan::metatransport::can::Frame_0_2 TFrame;
+
+  std::array<uint8_t, MetatransportCanCodec::MAX_FD_DATA_LENGTH> data{};
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = static_cast<uint8_t>(i + 1);
+
+  SECTION("encoded classic frames match the generated serialization")
+  {
+    std::array<uint8_t, MetatransportCanCodec::MAX_FRAME_SIZE> buf{};
+    auto const size = MetatransportCanCodec::encodeFrame(buf.data(), 0x107D552A, data.data(), 8);
+    REQUIRE(size.has_value());
+
+    TFrame frame;
+    nunavut::support::const_bitspan frame_bitspan(buf.data(), size.value());
+    REQUIRE(deserialize(frame, frame_bitspan));
+    REQUIRE(frame.is_data_classic());
+    REQUIRE(frame.get_data_classic().arbitration_id.is_extended());
+    REQUIRE(frame.get_data_classic().arbitration_id.get_extended().value == 0x107D552A);
+    REQUIRE(frame.get_data_classic().data.size() == 8);
+    REQUIRE(frame.get_data_classic().data[7] == 8);
+  }
+
+  SECTION("encoded FD frames match the generated serialization")
+  {
+    std::array<uint8_t, MetatransportCanCodec::MAX_FRAME_SIZE> buf{};
+    auto const size = MetatransportCanCodec::encodeFrame(buf.data(), 0x1FFFFFFF, data.data(), data.size());
+    REQUIRE(size.has_value());
+    REQUIRE(size.value() == TFrame::_traits_::SerializationBufferSizeBytes);
+
+    TFrame frame;
+    nunavut::support::const_bitspan frame_bitspan(buf.data(), size.value());
+    REQUIRE(deserialize(frame, frame_bitspan));
+    REQUIRE(frame.is_data_fd());
+    REQUIRE(frame.get_data_fd().arbitration_id.get_extended().value == 0x1FFFFFFF);
+    REQUIRE(frame.get_data_fd().data.size() == data.size());
+    REQUIRE(frame.get_data_fd().data[63] == 64);
+  }
+
+  SECTION("frames serialized by the generated code are decoded")
+  {
+    TFrame frame;
+    auto & data_classic = frame.set_data_classic();
+    data_classic.arbitration_id.set_extended().value = 0x1234567;
+    data_classic.data = {0xCA, 0xFE};
+
+    std::array<uint8_t, TFrame::_traits_::SerializationBufferSizeBytes> buf{};
+    nunavut::support::bitspan frame_bitspan{buf};
+    auto const rc = serialize(frame, frame_bitspan);
+    REQUIRE(rc);
+
+    auto const decoded = MetatransportCanCodec::decodeFrame(buf.data(), *rc);
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->extended_can_id == 0x1234567);
+    REQUIRE(decoded->data_length == 2);
+    REQUIRE(decoded->data[1] == 0xFE);
+  }
+
+  SECTION("frames with a base CAN-ID are not decoded")
+  {
+    TFrame frame;
+    frame.set_data_classic().arbitration_id.set_base().value = 0x123;
+
+    std::array<uint8_t, TFrame::_traits_::SerializationBufferSizeBytes> buf{};
+    nunavut::support::bitspan frame_bitspan{buf};
+    auto const rc = serialize(frame, frame_bitspan);
+    REQUIRE(rc);
+
+    REQUIRE_FALSE(MetatransportCanCodec::decodeFrame(buf.data(), *rc).has_value());
+  }
+
+  SECTION("truncated and oversized frames are rejected")
+  {
+    std::array<uint8_t, MetatransportCanCodec::MAX_FRAME_SIZE> buf{};
+    auto const size = MetatransportCanCodec::encodeFrame(buf.data(), 0x107D552A, data.data(), 8);
+    REQUIRE(size.has_value());
+    REQUIRE_FALSE(MetatransportCanCodec::decodeFrame(buf.data(), size.value() - 1).has_value());
+
+    buf[6] = 9; /* A classic frame carries at most 8 bytes. */
+    REQUIRE_FALSE(MetatransportCanCodec::decodeFrame(buf.data(), buf.size()).has_value());
+
+    REQUIRE_FALSE(MetatransportCanCodec::encodeFrame(buf.data(), 0, data.data(), data.size() + 1).has_value());
+  }
+}
+
+} /* cyphal::impl */
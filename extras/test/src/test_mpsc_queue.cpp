@@ -0,0 +1,135 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/queue/MpscQueue.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("MpscQueue")
+{
+  MpscQueue<int, 4> queue;
+
+  SECTION("an empty queue yields nothing")
+  {
+    REQUIRE(queue.empty());
+    REQUIRE_FALSE(queue.pop().has_value());
+  }
+
+  SECTION("elements are popped in the order they were pushed")
+  {
+    REQUIRE(queue.push(1));
+    REQUIRE(queue.push(2));
+    REQUIRE_FALSE(queue.empty());
+    REQUIRE(queue.pop().value() == 1);
+    REQUIRE(queue.pop().value() == 2);
+    REQUIRE(queue.empty());
+  }
+
+  SECTION("pushing to a full queue fails")
+  {
+    for (int i = 0; i < 4; i++)
+      REQUIRE(queue.push(i));
+    REQUIRE_FALSE(queue.push(4));
+
+    REQUIRE(queue.pop().value() == 0);
+    REQUIRE(queue.push(4));
+    for (int i = 1; i <= 4; i++)
+      REQUIRE(queue.pop().value() == i);
+  }
+}
+
+TEST_CASE("MpscQueue moves elements out of the queue")
+{
+  MpscQueue<std::shared_ptr<int>, 4> queue;
+  auto const element = std::make_shared<int>(42);
+
+  REQUIRE(queue.push(element));
+  REQUIRE(element.use_count() == 2);
+  {
+    auto const popped = queue.pop();
+    REQUIRE(popped.has_value());
+    REQUIRE(*popped.value() == 42);
+    REQUIRE(element.use_count() == 2);
+  }
+  REQUIRE(element.use_count() == 1);
+}
+
+TEST_CASE("MpscQueue in place access")
+{
+  MpscQueue<int, 4> queue;
+  std::array<int, 4> side_buf{};
+
+  for (int i = 0; i < 6; i++)
+  {
+    REQUIRE(queue.push_in_place([&side_buf, i](int & data, size_t const index)
+                                {
+                                  data = i;
+                                  side_buf[index] = 10 * i;
+                                }));
+    REQUIRE(queue.pop_in_place([&side_buf, i](int & data, size_t const index)
+                               {
+                                 REQUIRE(data == i);
+                                 REQUIRE(side_buf[index] == 10 * i);
+                               }));
+  }
+  REQUIRE_FALSE(queue.pop_in_place([](int &, size_t const) { }));
+}
+
+TEST_CASE("MpscQueue with concurrent producers")
+{
+  static size_t constexpr NUM_PRODUCERS = 4;
+  static int    constexpr NUM_ELEMENTS  = 10000;
+
+  MpscQueue<int, 64> queue;
+
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < NUM_PRODUCERS; p++)
+    producers.emplace_back([&queue, p]()
+    {
+      for (int i = 0; i < NUM_ELEMENTS; i++)
+        while (!queue.push(static_cast<int>(p) * NUM_ELEMENTS + i))
+          std::this_thread::yield();
+    });
+
+  /* Elements of each producer must arrive complete and in order. */
+  std::vector<int> next(NUM_PRODUCERS, 0);
+  size_t received = 0;
+  bool is_ordered = true;
+  while (received < NUM_PRODUCERS * NUM_ELEMENTS)
+  {
+    auto const val = queue.pop();
+    if (!val.has_value())
+      continue;
+    size_t const p = static_cast<size_t>(val.value() / NUM_ELEMENTS);
+    is_ordered &= ((val.value() % NUM_ELEMENTS) == next[p]);
+    next[p]++;
+    received++;
+  }
+
+  for (auto & producer : producers)
+    producer.join();
+
+  REQUIRE(is_ordered);
+  REQUIRE(queue.empty());
+}
+
+} /* cyphal::impl */
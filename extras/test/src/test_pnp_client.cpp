@@ -0,0 +1,141 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "NodeLoopback.hpp"
+
+#include <util/pnp/crc64we.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <optional>
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using namespace cyphal;
+
+typedef uavcan::pnp::NodeIDAllocationData_1_0 TAllocationData_1_0;
+typedef uavcan::pnp::NodeIDAllocationData_2_0 TAllocationData_2_0;
+
+/**************************************************************************************
+ * CONSTANTS
+ **************************************************************************************/
+
+static std::array<uint8_t, 16> const UNIQUE_ID = {0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87,
+                                                  0x98, 0xA9, 0xBA, 0xCB, 0xDC, 0xED, 0xFE, 0x0F};
+static CanardMicrosecond constexpr MAX_DURATION_usec = 3 * 1000 * 1000UL;
+
+/**************************************************************************************
+ * HELPER
+ **************************************************************************************/
+
+static bool is_message(NodeLoopback::Frame const & frame, CanardPortID const subject_id)
+{
+  return ((frame.extended_can_id >> 8U) & CANARD_SUBJECT_ID_MAX) == subject_id;
+}
+
+/* Returns the time at which node a sends its first allocation
+ * request, optionally after node b (which plays another node
+ * taking part in the allocation) published a foreign allocation
+ * message at foreign_msg_usec.
+ */
+template <typename TAllocationData>
+static std::optional<CanardMicrosecond> first_request_usec(size_t const mtu_bytes, std::optional<CanardMicrosecond> const foreign_msg_usec)
+{
+  NodeLoopback loop(mtu_bytes);
+  loop.hold_a_to_b = true;
+  auto foreign_pub = loop.b.create_publisher<TAllocationData>(1000*1000UL);
+  auto clt = loop.a.create_pnp_client(UNIQUE_ID);
+
+  for (CanardMicrosecond t = 0; t < MAX_DURATION_usec; t += 1000)
+  {
+    if (foreign_msg_usec.has_value() && (loop.now_usec == foreign_msg_usec.value()))
+      foreign_pub->publish(TAllocationData{});
+
+    loop.spin();
+
+    for (auto const & frame : loop.a_to_b)
+      if (is_message(frame, TAllocationData::_traits_::FixedPortId))
+        return loop.now_usec;
+    loop.a_to_b.clear();
+  }
+  return std::nullopt;
+}
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("PnpClient (NodeIDAllocationData.1.0)")
+{
+  SECTION("the node-ID granted for the hash of the unique-ID is applied")
+  {
+    NodeLoopback loop(CANARD_MTU_CAN_CLASSIC);
+    auto alloc_pub = loop.b.create_publisher<TAllocationData_1_0>(1000*1000UL);
+    auto clt = loop.a.create_pnp_client(UNIQUE_ID);
+    REQUIRE(loop.a.getNodeId() == CANARD_NODE_ID_UNSET);
+
+    TAllocationData_1_0 msg;
+    msg.unique_id_hash = impl::crc64we(UNIQUE_ID.data(), UNIQUE_ID.size()) & ((1ULL << 48U) - 1ULL);
+    msg.allocated_node_id.push_back(uavcan::node::ID_1_0{42});
+    alloc_pub->publish(msg);
+    loop.spin();
+
+    REQUIRE(clt->is_allocated());
+    REQUIRE(loop.a.getNodeId() == 42);
+  }
+
+  SECTION("foreign allocation messages restart the request timer")
+  {
+    auto const baseline_usec = first_request_usec<TAllocationData_1_0>(CANARD_MTU_CAN_CLASSIC, std::nullopt);
+    REQUIRE(baseline_usec.has_value());
+    REQUIRE(baseline_usec.value() > 1000*1000UL + 3000);
+
+    auto const foreign_msg_usec = baseline_usec.value() - 3000;
+    auto const request_usec = first_request_usec<TAllocationData_1_0>(CANARD_MTU_CAN_CLASSIC, foreign_msg_usec);
+    REQUIRE(request_usec.has_value());
+    REQUIRE(request_usec.value() > baseline_usec.value());
+  }
+}
+
+TEST_CASE("PnpClient (NodeIDAllocationData.2.0)")
+{
+  SECTION("the node-ID granted for the unique-ID is applied")
+  {
+    NodeLoopback loop(CANARD_MTU_CAN_FD);
+    auto alloc_pub = loop.b.create_publisher<TAllocationData_2_0>(1000*1000UL);
+    auto clt = loop.a.create_pnp_client(UNIQUE_ID);
+    REQUIRE(loop.a.getNodeId() == CANARD_NODE_ID_UNSET);
+
+    TAllocationData_2_0 msg;
+    msg.node_id.value = 42;
+    msg.unique_id = UNIQUE_ID;
+    alloc_pub->publish(msg);
+    loop.spin();
+
+    REQUIRE(clt->is_allocated());
+    REQUIRE(loop.a.getNodeId() == 42);
+  }
+
+  SECTION("foreign allocation messages restart the request timer")
+  {
+    auto const baseline_usec = first_request_usec<TAllocationData_2_0>(CANARD_MTU_CAN_FD, std::nullopt);
+    REQUIRE(baseline_usec.has_value());
+    REQUIRE(baseline_usec.value() > 1000*1000UL + 3000);
+
+    auto const foreign_msg_usec = baseline_usec.value() - 3000;
+    auto const request_usec = first_request_usec<TAllocationData_2_0>(CANARD_MTU_CAN_FD, foreign_msg_usec);
+    REQUIRE(request_usec.has_value());
+    REQUIRE(request_usec.value() > baseline_usec.value());
+  }
+}
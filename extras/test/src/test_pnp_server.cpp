@@ -0,0 +1,116 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "NodeLoopback.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstring>
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using namespace cyphal;
+using namespace cyphal::support::platform::storage;
+
+typedef uavcan::node::Heartbeat_1_0 THeartbeat;
+
+/**************************************************************************************
+ * HELPER
+ **************************************************************************************/
+
+class MemoryKeyValueStorage : public interface::KeyValueStorage
+{
+public:
+  [[nodiscard]] virtual auto get(const std::string_view key, const std::size_t size, void* const data) const -> std::variant<Error, std::size_t> override
+  {
+    auto const iter = _entries.find(std::string(key));
+    if (iter == _entries.end())
+      return Error::Existence;
+    size_t const len = std::min(size, iter->second.size());
+    std::memcpy(data, iter->second.data(), len);
+    return len;
+  }
+
+  [[nodiscard]] virtual auto put(const std::string_view key, const std::size_t size, const void* const data) -> std::optional<Error> override
+  {
+    uint8_t const * bytes = static_cast<uint8_t const *>(data);
+    _entries[std::string(key)] = std::vector<uint8_t>(bytes, bytes + size);
+    return std::nullopt;
+  }
+
+  [[nodiscard]] virtual auto drop(const std::string_view key) -> std::optional<Error> override
+  {
+    if (_entries.erase(std::string(key)) == 0)
+      return Error::Existence;
+    return std::nullopt;
+  }
+
+private:
+  std::map<std::string, std::vector<uint8_t>> _entries;
+};
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("PnpServer records statically configured nodes next to an application Heartbeat subscription")
+{
+  NodeLoopback loop;
+  MemoryKeyValueStorage kv_storage;
+  auto heartbeat_pub = loop.b.create_publisher<THeartbeat>(1000*1000UL);
+
+  size_t num_received = 0;
+  auto on_heartbeat = [&num_received](THeartbeat const &) { num_received++; };
+
+  auto publish_heartbeat = [&](CanardNodeID const node_id)
+  {
+    loop.b.setNodeId(node_id);
+    heartbeat_pub->publish(THeartbeat{});
+    loop.spin();
+  };
+
+  SECTION("the application subscribes before the server is created")
+  {
+    auto heartbeat_sub = loop.a.create_subscription<THeartbeat>(on_heartbeat);
+    auto srv = loop.a.create_pnp_server(kv_storage);
+    REQUIRE(srv->allocation_count() == 1);
+
+    publish_heartbeat(NodeLoopback::NODE_ID_B);
+    REQUIRE(num_received == 1);
+    REQUIRE(srv->allocation_count() == 2);
+
+    /* The server keeps receiving once the application unsubscribed. */
+    heartbeat_sub.reset();
+    publish_heartbeat(30);
+    REQUIRE(num_received == 1);
+    REQUIRE(srv->allocation_count() == 3);
+  }
+
+  SECTION("the application subscribes after the server was created")
+  {
+    auto srv = loop.a.create_pnp_server(kv_storage);
+    auto heartbeat_sub = loop.a.create_subscription<THeartbeat>(on_heartbeat);
+
+    publish_heartbeat(NodeLoopback::NODE_ID_B);
+    REQUIRE(num_received == 1);
+    REQUIRE(srv->allocation_count() == 2);
+
+    /* The application keeps receiving once the server is destroyed. */
+    srv.reset();
+    publish_heartbeat(30);
+    REQUIRE(num_received == 2);
+  }
+}
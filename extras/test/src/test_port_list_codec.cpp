@@ -0,0 +1,130 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/port/PortListCodec.hpp>
+#include <util/view/PortListView.hpp>
+#include <DSDL_Types/uavcan/node.h>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <vector>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("PortListCodec")
+{
+  typedef uavcan::node::port::List_1_0 TPortList;
+
+  PortSet publishers, subscribers, clients, servers;
+  clients.add(430);
+  servers.add(384);
+  servers.add(511);
+
+  /* Encodes the same port list via the generated code. */
+  auto serialize_generated = [&](std::vector<uint8_t> & buf)
+  {
+    auto list_msg = std::make_unique<TPortList>();
+    auto fill_subject_list = [](uavcan::node::port::SubjectIDList_1_0 & subject_list, PortSet const & ports)
+    {
+      if ((ports.size() * PortListCodec::SPARSE_LIST_ENTRY_SIZE) < PortListCodec::SUBJECT_ID_MASK_SIZE)
+      {
+        auto & sparse_list = subject_list.set_sparse_list();
+        for (auto const & [port_id, ref_cnt] : ports)
+          sparse_list.push_back(uavcan::node::port::SubjectID_1_0{port_id});
+      }
+      else
+      {
+        auto & mask = subject_list.set_mask();
+        for (auto const & [port_id, ref_cnt] : ports)
+          mask.set(port_id);
+      }
+    };
+    fill_subject_list(list_msg->publishers, publishers);
+    fill_subject_list(list_msg->subscribers, subscribers);
+    for (auto const & [port_id, ref_cnt] : clients) list_msg->clients.mask.set(port_id);
+    for (auto const & [port_id, ref_cnt] : servers) list_msg->servers.mask.set(port_id);
+
+    buf.resize(TPortList::_traits_::SerializationBufferSizeBytes);
+    nunavut::support::bitspan buf_bitspan{buf.data(), buf.size()};
+    auto const rc = serialize(*list_msg, buf_bitspan);
+    REQUIRE(rc);
+    buf.resize(*rc);
+  };
+
+  std::array<uint8_t, PortListCodec::MAX_SIZE> buf{};
+
+  SECTION("small port sets are encoded as sparse lists")
+  {
+    publishers.add(7509);
+    publishers.add(8191);
+    subscribers.add(0);
+
+    size_t const size = PortListCodec::encode(buf.data(), publishers, subscribers, clients, servers);
+
+    std::vector<uint8_t> expected;
+    serialize_generated(expected);
+    REQUIRE(size == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), buf.begin()));
+
+    PortListView const view(buf.data(), size);
+    REQUIRE(view.valid());
+    REQUIRE(view.publishers().is_sparse_list());
+    REQUIRE(view.publishers().sparse_list_size() == 2);
+    REQUIRE(view.publishers().contains(8191));
+    REQUIRE(view.subscribers().contains(0));
+    REQUIRE(view.clients().contains(430));
+    REQUIRE(view.servers().contains(511));
+    REQUIRE_FALSE(view.servers().contains(430));
+  }
+
+  SECTION("large port sets are encoded as masks")
+  {
+    for (CanardPortID port_id = 0; port_id < 8192; port_id += 13)
+      subscribers.add(port_id);
+
+    size_t const size = PortListCodec::encode(buf.data(), publishers, subscribers, clients, servers);
+
+    std::vector<uint8_t> expected;
+    serialize_generated(expected);
+    REQUIRE(size == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), buf.begin()));
+
+    PortListView const view(buf.data(), size);
+    REQUIRE(view.valid());
+    REQUIRE(view.subscribers().is_mask());
+    REQUIRE(view.subscribers().contains(13 * 600));
+    REQUIRE_FALSE(view.subscribers().contains(1));
+    REQUIRE(view.publishers().is_sparse_list());
+  }
+
+  SECTION("the buffer bounds the largest port list")
+  {
+    for (CanardPortID port_id = 0; port_id < 8192; port_id++) {
+      publishers.add(port_id);
+      subscribers.add(port_id);
+    }
+    for (CanardPortID port_id = 0; port_id < 512; port_id++) {
+      clients.add(port_id);
+      servers.add(port_id);
+    }
+
+    REQUIRE(PortListCodec::encode(buf.data(), publishers, subscribers, clients, servers) == PortListCodec::MAX_SIZE);
+  }
+}
+
+} /* cyphal::impl */
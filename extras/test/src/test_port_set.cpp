@@ -0,0 +1,60 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/port/PortSet.hpp>
+#include <catch2/catch.hpp>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("PortSet")
+{
+  PortSet ports;
+  REQUIRE(ports.empty());
+
+  SECTION("ports are kept sorted and unique")
+  {
+    REQUIRE(ports.add(300));
+    REQUIRE(ports.add(7));
+    REQUIRE(ports.add(7509));
+    REQUIRE_FALSE(ports.add(7));
+    REQUIRE(3 == ports.size());
+
+    std::vector<CanardPortID> port_ids;
+    for (auto const & [port_id, ref_cnt] : ports)
+      port_ids.push_back(port_id);
+    REQUIRE(port_ids == std::vector<CanardPortID>{7, 300, 7509});
+  }
+
+  SECTION("a port is removed with its last reference")
+  {
+    REQUIRE(ports.add(42));
+    REQUIRE_FALSE(ports.add(42));
+    REQUIRE_FALSE(ports.remove(42));
+    REQUIRE(ports.contains(42));
+    REQUIRE(ports.remove(42));
+    REQUIRE_FALSE(ports.contains(42));
+    REQUIRE(ports.empty());
+  }
+
+  SECTION("removing an unknown port is a no-op")
+  {
+    REQUIRE(ports.add(1));
+    REQUIRE_FALSE(ports.remove(2));
+    REQUIRE(1 == ports.size());
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,113 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/file/ReadCodec.hpp>
+#include <DSDL_Types/uavcan/file.h>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("ReadCodec")
+{
+  typedef uavcan::file::Read::Request_1_1 TReadRequest;
+  typedef uavcan::file::Read::Response_1_1 TReadResponse;
+
+  SECTION("encoded requests match the generated serialization")
+  {
+    std::string const path = "fw/image.bin";
+
+    std::array<uint8_t, ReadCodec::REQUEST_BUFFER_SIZE> buf{};
+    auto const size = ReadCodec::encodeRequest(buf.data(), 0x0102030405ULL, path);
+    REQUIRE(size.has_value());
+
+    TReadRequest req;
+    nunavut::support::const_bitspan req_bitspan(buf.data(), size.value());
+    REQUIRE(deserialize(req, req_bitspan));
+    REQUIRE(req.offset == 0x0102030405ULL);
+    REQUIRE(std::string(req.path.path.begin(), req.path.path.end()) == path);
+  }
+
+  SECTION("requests serialized by the generated code are decoded")
+  {
+    TReadRequest req;
+    req.offset = 256 * 1024;
+    std::string const path = "log/0001.txt";
+    req.path.path.assign(path.begin(), path.end());
+
+    std::array<uint8_t, TReadRequest::_traits_::SerializationBufferSizeBytes> buf{};
+    nunavut::support::bitspan req_bitspan{buf};
+    auto const rc = serialize(req, req_bitspan);
+    REQUIRE(rc);
+
+    auto const decoded = ReadCodec::decodeRequest(buf.data(), *rc);
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->offset == req.offset);
+    REQUIRE(decoded->path == path);
+  }
+
+  SECTION("truncated requests are rejected")
+  {
+    std::array<uint8_t, 8> const buf{0, 0, 0, 0, 0, 5, 'a', 'b'};
+    REQUIRE_FALSE(ReadCodec::decodeRequest(buf.data(), buf.size()).has_value());
+    REQUIRE_FALSE(ReadCodec::decodeRequest(buf.data(), 5).has_value());
+  }
+
+  SECTION("oversized requests are not encoded")
+  {
+    std::array<uint8_t, ReadCodec::REQUEST_BUFFER_SIZE> buf{};
+    REQUIRE_FALSE(ReadCodec::encodeRequest(buf.data(), ReadCodec::MAX_OFFSET + 1, "a").has_value());
+    REQUIRE_FALSE(ReadCodec::encodeRequest(buf.data(), 0, std::string(ReadCodec::MAX_PATH_LENGTH + 1, 'a')).has_value());
+  }
+
+  SECTION("encoded responses match the generated serialization")
+  {
+    std::array<uint8_t, ReadCodec::RESPONSE_BUFFER_SIZE> buf{};
+    uint8_t * data = ReadCodec::responseData(buf.data());
+    for (size_t i = 0; i < ReadCodec::MAX_DATA_LENGTH; i++)
+      data[i] = static_cast<uint8_t>(i);
+    size_t const size = ReadCodec::encodeResponseHeader(buf.data(), uavcan::file::Error_1_0::OK, ReadCodec::MAX_DATA_LENGTH);
+    REQUIRE(size == TReadResponse::_traits_::SerializationBufferSizeBytes);
+
+    TReadResponse rsp;
+    nunavut::support::const_bitspan rsp_bitspan(buf.data(), size);
+    REQUIRE(deserialize(rsp, rsp_bitspan));
+    REQUIRE(rsp._error.value == uavcan::file::Error_1_0::OK);
+    REQUIRE(rsp.data.value.size() == ReadCodec::MAX_DATA_LENGTH);
+    REQUIRE(rsp.data.value[255] == 255);
+
+    auto const decoded = ReadCodec::decodeResponse(buf.data(), size);
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->error == uavcan::file::Error_1_0::OK);
+    REQUIRE(decoded->data_length == ReadCodec::MAX_DATA_LENGTH);
+    REQUIRE(decoded->data[17] == 17);
+  }
+
+  SECTION("error responses carry no data")
+  {
+    std::array<uint8_t, ReadCodec::RESPONSE_BUFFER_SIZE> buf{};
+    size_t const size = ReadCodec::encodeResponseHeader(buf.data(), uavcan::file::Error_1_0::NOT_FOUND, 0);
+
+    auto const decoded = ReadCodec::decodeResponse(buf.data(), size);
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->error == uavcan::file::Error_1_0::NOT_FOUND);
+    REQUIRE(decoded->data_length == 0);
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,148 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "NodeLoopback.hpp"
+
+#include <catch2/catch.hpp>
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using namespace cyphal;
+using namespace cyphal::support::platform::file;
+
+typedef uavcan::node::Heartbeat_1_0 THeartbeat;
+
+/**************************************************************************************
+ * HELPER
+ **************************************************************************************/
+
+class EmptyFileSource : public interface::FileSource
+{
+public:
+  [[nodiscard]] virtual auto read(const std::string_view,
+                                  const std::uint64_t,
+                                  const std::size_t,
+                                  void* const) -> std::variant<Error, std::size_t> override
+  {
+    return static_cast<size_t>(0);
+  }
+};
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("Subscriptions sharing a subject")
+{
+  NodeLoopback loop;
+  auto heartbeat_pub = loop.b.create_publisher<THeartbeat>(1000*1000UL);
+
+  size_t num_received_1 = 0, num_received_2 = 0;
+  auto sub_1 = loop.a.create_subscription<THeartbeat>([&num_received_1](THeartbeat const &) { num_received_1++; });
+  auto sub_2 = loop.a.create_subscription<THeartbeat>([&num_received_2](THeartbeat const &) { num_received_2++; });
+  REQUIRE(sub_1);
+  REQUIRE(sub_2);
+
+  auto publish_heartbeat = [&]()
+  {
+    heartbeat_pub->publish(THeartbeat{});
+    loop.spin();
+  };
+
+  SECTION("each subscription receives every message")
+  {
+    publish_heartbeat();
+    publish_heartbeat();
+    REQUIRE(num_received_1 == 2);
+    REQUIRE(num_received_2 == 2);
+  }
+
+  SECTION("destroying a subscription does not affect the others")
+  {
+    sub_1.reset();
+    publish_heartbeat();
+    REQUIRE(num_received_1 == 0);
+    REQUIRE(num_received_2 == 1);
+
+    size_t num_received_3 = 0;
+    auto sub_3 = loop.a.create_subscription<THeartbeat>([&num_received_3](THeartbeat const &) { num_received_3++; });
+    publish_heartbeat();
+    REQUIRE(num_received_2 == 2);
+    REQUIRE(num_received_3 == 1);
+
+    sub_2.reset();
+    publish_heartbeat();
+    REQUIRE(num_received_3 == 2);
+  }
+
+  SECTION("the subject is unsubscribed along with the last subscription")
+  {
+    sub_2.reset();
+    sub_1.reset();
+    publish_heartbeat();
+
+    size_t num_received_3 = 0;
+    auto sub_3 = loop.a.create_subscription<THeartbeat>([&num_received_3](THeartbeat const &) { num_received_3++; });
+    publish_heartbeat();
+    REQUIRE(num_received_1 == 0);
+    REQUIRE(num_received_2 == 0);
+    REQUIRE(num_received_3 == 1);
+  }
+
+  SECTION("a subscription may destroy another one from within its callback")
+  {
+    sub_2 = loop.a.create_subscription<THeartbeat>([&](THeartbeat const &) { num_received_2++; sub_1.reset(); });
+    publish_heartbeat();
+    publish_heartbeat();
+    REQUIRE(num_received_1 <= 1);
+    REQUIRE(num_received_2 == 2);
+  }
+
+  SECTION("pending transfers are only dispatched to the remaining subscriptions")
+  {
+    /* Only a single transfer is dispatched per spinSome(). */
+    loop.a.enable_deferred_dispatch(8, 0);
+    heartbeat_pub->publish(THeartbeat{});
+    heartbeat_pub->publish(THeartbeat{});
+    loop.b.spinSome();
+    for (auto const & f : loop.b_to_a)
+      loop.a.onCanFrameReceived(CanardFrame{f.extended_can_id, f.payload.size(), f.payload.data()});
+    loop.b_to_a.clear();
+
+    loop.a.spinSome();
+    REQUIRE(num_received_1 == 1);
+    REQUIRE(num_received_2 == 1);
+
+    sub_1.reset();
+    loop.a.spinSome();
+    REQUIRE(num_received_1 == 1);
+    REQUIRE(num_received_2 == 2);
+  }
+
+  SECTION("the software updater does not take over the heartbeat subscription")
+  {
+    EmptyFileSource file_source;
+    auto file_server = loop.a.create_file_server(file_source);
+    auto updater = loop.a.create_software_updater(file_server, "image.bin", {NodeLoopback::NODE_ID_B});
+    REQUIRE(updater);
+
+    publish_heartbeat();
+    REQUIRE(num_received_1 == 1);
+    REQUIRE(num_received_2 == 1);
+
+    updater.reset();
+    publish_heartbeat();
+    REQUIRE(num_received_1 == 2);
+    REQUIRE(num_received_2 == 2);
+  }
+}
@@ -0,0 +1,112 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/port/SubjectDispatcher.hpp>
+#include <catch2/catch.hpp>
+
+#include <functional>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+namespace
+{
+
+class CallbackSubscription final : public SubscriptionBase
+{
+public:
+  CallbackSubscription() : SubscriptionBase{CanardTransferKindMessage}, num_received{0} { }
+
+  size_t num_received;
+  std::function<void()> on_received;
+
+  virtual bool onTransferReceived(CanardRxTransfer const &) override
+  {
+    num_received++;
+    if (on_received)
+      on_received();
+    return true;
+  }
+};
+
+} /* namespace */
+
+TEST_CASE("SubjectDispatcher")
+{
+  SubjectDispatcher dispatcher(7509);
+  CallbackSubscription sub_a, sub_b, sub_c;
+  CanardRxTransfer const transfer{};
+
+  dispatcher.add(sub_a, 12);
+  dispatcher.add(sub_b, 24);
+  REQUIRE(dispatcher.port_id() == 7509);
+  REQUIRE(dispatcher.canard_rx_subscription().user_reference == static_cast<SubscriptionBase *>(&dispatcher));
+
+  SECTION("each transfer is dispatched to all subscriptions")
+  {
+    REQUIRE(dispatcher.onTransferReceived(transfer));
+    REQUIRE(sub_a.num_received == 1);
+    REQUIRE(sub_b.num_received == 1);
+  }
+
+  SECTION("the largest extent is subscribed")
+  {
+    REQUIRE(dispatcher.extent() == 24);
+    dispatcher.add(sub_c, 8);
+    REQUIRE(dispatcher.extent() == 24);
+  }
+
+  SECTION("subscriptions are only added once")
+  {
+    dispatcher.add(sub_a, 12);
+    dispatcher.onTransferReceived(transfer);
+    REQUIRE(sub_a.num_received == 1);
+  }
+
+  SECTION("removed subscriptions are no longer dispatched to")
+  {
+    REQUIRE(dispatcher.remove(sub_a));
+    REQUIRE_FALSE(dispatcher.remove(sub_a));
+    REQUIRE_FALSE(dispatcher.contains(sub_a));
+    dispatcher.onTransferReceived(transfer);
+    REQUIRE(sub_a.num_received == 0);
+    REQUIRE(sub_b.num_received == 1);
+
+    REQUIRE(dispatcher.remove(sub_b));
+    REQUIRE(dispatcher.empty());
+    REQUIRE_FALSE(dispatcher.onTransferReceived(transfer));
+  }
+
+  SECTION("a subscription removed from within a callback is skipped")
+  {
+    sub_a.on_received = [&]() { REQUIRE(dispatcher.remove(sub_b)); REQUIRE(dispatcher.is_dispatching()); };
+    dispatcher.onTransferReceived(transfer);
+    REQUIRE(sub_b.num_received == 0);
+    REQUIRE_FALSE(dispatcher.is_dispatching());
+    REQUIRE_FALSE(dispatcher.contains(sub_b));
+    REQUIRE_FALSE(dispatcher.empty());
+  }
+
+  SECTION("a subscription added from within a callback only receives subsequent transfers")
+  {
+    sub_a.on_received = [&]() { dispatcher.add(sub_c, 8); };
+    dispatcher.onTransferReceived(transfer);
+    REQUIRE(sub_c.num_received == 0);
+    dispatcher.onTransferReceived(transfer);
+    REQUIRE(sub_c.num_received == 1);
+  }
+}
+
+} /* cyphal::impl */
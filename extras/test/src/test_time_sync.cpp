@@ -0,0 +1,70 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "NodeLoopback.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using namespace cyphal;
+
+typedef uavcan::time::Synchronization_1_0 TSynchronization;
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("TimeSyncMaster")
+{
+  static CanardMicrosecond constexpr PUBLICATION_PERIOD_usec = TSynchronization::MAX_PUBLICATION_PERIOD * 1000 * 1000UL;
+
+  NodeLoopback loop;
+  auto master = loop.a.create_time_sync_master();
+
+  std::vector<CanardMicrosecond> prev_tx_timestamps;
+  auto sub = loop.b.create_subscription<TSynchronization>(
+    [&prev_tx_timestamps](TSynchronization const & msg)
+    {
+      prev_tx_timestamps.push_back(msg.previous_transmission_timestamp_microsecond);
+    });
+
+  SECTION("without reported transmissions the previous transmission timestamp is unknown")
+  {
+    loop.spin_for(3 * PUBLICATION_PERIOD_usec, 100*1000UL);
+
+    REQUIRE(prev_tx_timestamps.size() >= 3);
+    for (auto const prev_tx_timestamp : prev_tx_timestamps)
+      REQUIRE(prev_tx_timestamp == 0);
+  }
+
+  SECTION("the reported transmission timestamp is published with the next message")
+  {
+    loop.hold_a_to_b = true;
+    loop.spin();
+    REQUIRE(loop.a_to_b.size() == 1);
+
+    /* The frame left the bus well after it was handed over. */
+    CanardMicrosecond const tx_timestamp_usec = loop.now_usec + 1234;
+    NodeLoopback::Frame const & f = loop.a_to_b.front();
+    loop.a.onCanFrameTransmitted(CanardFrame{f.extended_can_id, f.payload.size(), f.payload.data()}, tx_timestamp_usec);
+    loop.hold_a_to_b = false;
+
+    loop.spin_for(PUBLICATION_PERIOD_usec, 100*1000UL);
+    REQUIRE(prev_tx_timestamps.size() == 2);
+    REQUIRE(prev_tx_timestamps[0] == 0);
+    REQUIRE(prev_tx_timestamps[1] == tx_timestamp_usec);
+  }
+}
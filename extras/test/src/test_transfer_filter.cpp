@@ -0,0 +1,86 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/transfer_filter.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+TEST_CASE("TransferFilter")
+{
+  std::array<uint8_t, 2> payload{7, 0};
+
+  CanardRxTransfer transfer{};
+  transfer.metadata.priority       = CanardPriorityNominal;
+  transfer.metadata.remote_node_id = 42;
+  transfer.payload_size            = payload.size();
+  transfer.payload                 = payload.data();
+
+  SECTION("a default constructed filter accepts every transfer")
+  {
+    TransferFilter const filter;
+    REQUIRE(filter.accepts(transfer));
+    transfer.metadata.priority       = CanardPriorityOptional;
+    transfer.metadata.remote_node_id = CANARD_NODE_ID_UNSET;
+    REQUIRE(filter.accepts(transfer));
+  }
+
+  SECTION("only transfers of the given nodes are accepted")
+  {
+    TransferFilter filter;
+    filter.from(1).from(42);
+    REQUIRE(filter.accepts(transfer));
+    transfer.metadata.remote_node_id = 1;
+    REQUIRE(filter.accepts(transfer));
+    transfer.metadata.remote_node_id = 43;
+    REQUIRE_FALSE(filter.accepts(transfer));
+    transfer.metadata.remote_node_id = CANARD_NODE_ID_UNSET;
+    REQUIRE_FALSE(filter.accepts(transfer));
+  }
+
+  SECTION("transfers of a lower priority are rejected")
+  {
+    TransferFilter filter;
+    filter.with_priority(CanardPriorityHigh);
+    REQUIRE_FALSE(filter.accepts(transfer));
+    transfer.metadata.priority = CanardPriorityHigh;
+    REQUIRE(filter.accepts(transfer));
+    transfer.metadata.priority = CanardPriorityExceptional;
+    REQUIRE(filter.accepts(transfer));
+  }
+
+  SECTION("the payload predicate is evaluated on the serialized payload")
+  {
+    TransferFilter filter;
+    filter.payload([](uint8_t const * data, size_t const size) { return (size > 0) && (data[0] == 7); });
+    REQUIRE(filter.accepts(transfer));
+    payload[0] = 8;
+    REQUIRE_FALSE(filter.accepts(transfer));
+  }
+
+  SECTION("the payload predicate is not evaluated for transfers of other nodes")
+  {
+    bool is_evaluated = false;
+    TransferFilter filter;
+    filter.from(1).payload([&is_evaluated](uint8_t const *, size_t const) { is_evaluated = true; return true; });
+    REQUIRE_FALSE(filter.accepts(transfer));
+    REQUIRE_FALSE(is_evaluated);
+  }
+}
+
+} /* cyphal */
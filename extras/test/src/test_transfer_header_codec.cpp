@@ -0,0 +1,148 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/transport/TransferHeaderCodec.hpp>
+#include <util/transport/crc32c.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("transport CRCs")
+{
+  std::string const check = "123456789";
+  uint8_t const * data = reinterpret_cast<uint8_t const *>(check.data());
+
+  SECTION("crc16ccitt check value")
+  {
+    REQUIRE(0x29B1 == crc16ccitt(data, check.size()));
+  }
+
+  SECTION("crc32c check value")
+  {
+    REQUIRE(0xE3069283UL == Crc32c::compute(data, check.size()));
+  }
+
+  SECTION("crc32c computed incrementally")
+  {
+    uint32_t crc = Crc32c::INITIAL;
+    crc = Crc32c::add(crc, data, 4);
+    crc = Crc32c::add(crc, data + 4, check.size() - 4);
+    REQUIRE(0xE3069283UL == Crc32c::finalize(crc));
+  }
+
+  SECTION("crc32c over data and little-endian CRC yields the residue")
+  {
+    std::array<uint8_t, 4> const crc_buf{0x83, 0x92, 0x06, 0xE3};
+    uint32_t crc = Crc32c::add(Crc32c::INITIAL, data, check.size());
+    crc = Crc32c::add(crc, crc_buf.data(), crc_buf.size());
+    REQUIRE(Crc32c::RESIDUE == crc);
+  }
+}
+
+TEST_CASE("TransferHeaderCodec")
+{
+  TransferHeader header;
+  header.priority            = CanardPriorityHigh;
+  header.source_node_id      = 0x0123;
+  header.destination_node_id = 0x0456;
+  header.transfer_kind       = CanardTransferKindRequest;
+  header.port_id             = 430;
+  header.transfer_id         = 0x0102030405060708ULL;
+  header.frame_index         = 3;
+  header.end_of_transfer     = true;
+
+  std::array<uint8_t, TransferHeaderCodec::HEADER_SIZE> buf{};
+  TransferHeaderCodec::encode(buf.data(), header);
+
+  SECTION("header layout")
+  {
+    REQUIRE(buf[0] == 1);
+    REQUIRE(buf[1] == CanardPriorityHigh);
+    REQUIRE(buf[2] == 0x23);
+    REQUIRE(buf[3] == 0x01);
+    REQUIRE(buf[4] == 0x56);
+    REQUIRE(buf[5] == 0x04);
+    /* Service request 430: 0x8000 | 0x4000 | 0x01AE. */
+    REQUIRE(buf[6] == 0xAE);
+    REQUIRE(buf[7] == 0xC1);
+    REQUIRE(buf[8] == 0x08);
+    REQUIRE(buf[15] == 0x01);
+    REQUIRE(buf[16] == 0x03);
+    REQUIRE(buf[19] == 0x80);
+    REQUIRE(buf[20] == 0x00);
+    REQUIRE(buf[21] == 0x00);
+  }
+
+  SECTION("the header CRC covers the complete header")
+  {
+    /* The CRC is stored big-endian, hence the residue is zero. */
+    REQUIRE(0 == crc16ccitt(buf.data(), buf.size()));
+  }
+
+  SECTION("decoded header matches the encoded one")
+  {
+    auto const decoded = TransferHeaderCodec::decode(buf.data(), buf.size());
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded->priority            == CanardPriorityHigh);
+    REQUIRE(decoded->source_node_id      == 0x0123);
+    REQUIRE(decoded->destination_node_id == 0x0456);
+    REQUIRE(decoded->transfer_kind       == CanardTransferKindRequest);
+    REQUIRE(decoded->port_id             == 430);
+    REQUIRE(decoded->transfer_id         == 0x0102030405060708ULL);
+    REQUIRE(decoded->frame_index         == 3);
+    REQUIRE(decoded->end_of_transfer);
+  }
+
+  SECTION("messages and responses are distinguished")
+  {
+    header.transfer_kind = CanardTransferKindMessage;
+    header.port_id = 7509;
+    TransferHeaderCodec::encode(buf.data(), header);
+    auto msg = TransferHeaderCodec::decode(buf.data(), buf.size());
+    REQUIRE(msg.has_value());
+    REQUIRE(msg->transfer_kind == CanardTransferKindMessage);
+    REQUIRE(msg->port_id == 7509);
+
+    header.transfer_kind = CanardTransferKindResponse;
+    header.port_id = 430;
+    header.end_of_transfer = false;
+    TransferHeaderCodec::encode(buf.data(), header);
+    auto rsp = TransferHeaderCodec::decode(buf.data(), buf.size());
+    REQUIRE(rsp.has_value());
+    REQUIRE(rsp->transfer_kind == CanardTransferKindResponse);
+    REQUIRE(rsp->port_id == 430);
+    REQUIRE(!rsp->end_of_transfer);
+  }
+
+  SECTION("corrupted or truncated headers are rejected")
+  {
+    REQUIRE(!TransferHeaderCodec::decode(buf.data(), buf.size() - 1).has_value());
+
+    buf[10] ^= 0x01;
+    REQUIRE(!TransferHeaderCodec::decode(buf.data(), buf.size()).has_value());
+  }
+
+  SECTION("other header versions are rejected")
+  {
+    buf[0] = 2;
+    REQUIRE(!TransferHeaderCodec::decode(buf.data(), buf.size()).has_value());
+  }
+}
+
+} /* cyphal::impl */
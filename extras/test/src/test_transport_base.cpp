@@ -0,0 +1,403 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/transport/udp/UdpTransport.hpp>
+#include <catch2/catch.hpp>
+
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include <numeric>
+
+/**************************************************************************************
+ * HELPER
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+static size_t num_allocated = 0;
+
+static void * test_allocate(CanardInstance * const, size_t const amount)
+{
+  num_allocated++;
+  return std::malloc(amount);
+}
+
+static void test_free(CanardInstance * const, void * const pointer)
+{
+  if (pointer)
+    num_allocated--;
+  std::free(pointer);
+}
+
+/* Records the frames of transmitted transfers, which are
+ * then fed to another transport in any desired order.
+ */
+class TestTransport final : public TransportBase
+{
+public:
+  struct Frame
+  {
+    TransferHeader header;
+    std::vector<uint8_t> payload;
+  };
+
+
+  TestTransport(CanardInstance & canard_hdl, size_t const mtu_bytes)
+  : TransportBase{canard_hdl}
+  , _mtu_bytes{mtu_bytes}
+  { }
+
+
+  [[nodiscard]] virtual size_t mtu() const override { return _mtu_bytes; }
+  [[nodiscard]] virtual bool subscribe(CanardTransferKind const, CanardPortID const) override { return true; }
+  virtual void unsubscribe(CanardTransferKind const, CanardPortID const) override { }
+  virtual void processRx(CanardMicrosecond const) override { }
+
+  void receive(Frame & frame, CanardMicrosecond const timestamp_usec)
+  {
+    processRxFrame(frame.header, frame.payload.data(), frame.payload.size(), timestamp_usec);
+  }
+
+  std::vector<Frame> frames;
+
+
+protected:
+  virtual bool transmitTransfer(TransferHeader const & header, size_t const payload_size, uint8_t const * const payload) override
+  {
+    return forEachFrame(header, payload_size, payload, _mtu_bytes,
+                        [this](auto const & header_buf, Slice const & payload_slice, Slice const & crc_slice)
+                        {
+                          auto const frame_header = TransferHeaderCodec::decode(header_buf.data(), header_buf.size());
+                          REQUIRE(frame_header.has_value());
+                          Frame frame{frame_header.value(), std::vector<uint8_t>(payload_slice.data, payload_slice.data + payload_slice.size)};
+                          frame.payload.insert(frame.payload.end(), crc_slice.data, crc_slice.data + crc_slice.size);
+                          frames.push_back(frame);
+                          return true;
+                        });
+  }
+
+
+private:
+  size_t const _mtu_bytes;
+};
+
+class TestSubscription final : public SubscriptionBase
+{
+public:
+  struct Transfer
+  {
+    CanardNodeID remote_node_id;
+    CanardTransferID transfer_id;
+    std::vector<uint8_t> payload;
+  };
+
+
+  TestSubscription(CanardInstance & canard_hdl, CanardTransferKind const transfer_kind, CanardPortID const port_id, size_t const extent, CanardMicrosecond const tid_timeout_usec)
+  : SubscriptionBase{transfer_kind}
+  {
+    REQUIRE(canardRxSubscribe(&canard_hdl, transfer_kind, port_id, extent, tid_timeout_usec, &canard_rx_subscription()) == 1);
+  }
+
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    uint8_t const * payload = static_cast<uint8_t const *>(transfer.payload);
+    transfers.push_back(Transfer{transfer.metadata.remote_node_id, transfer.metadata.transfer_id, std::vector<uint8_t>(payload, payload + transfer.payload_size)});
+    return true;
+  }
+
+  std::vector<Transfer> transfers;
+};
+
+class TestUdpSocket final : public support::platform::udp::interface::UdpSocket
+{
+public:
+  typedef support::platform::udp::Error Error;
+
+  [[nodiscard]] virtual auto send(const std::uint32_t, const support::platform::udp::Fragment* const, const std::size_t) -> std::optional<Error> override { return std::nullopt; }
+  [[nodiscard]] virtual auto receive(support::platform::udp::Datagram* const, const std::size_t) -> std::variant<Error, std::size_t> override { return static_cast<size_t>(0); }
+  [[nodiscard]] virtual auto join(const std::uint32_t group_address) -> std::optional<Error> override
+  {
+    if (fail_join)
+      return Error::Internal;
+    groups.insert(group_address);
+    return std::nullopt;
+  }
+  virtual void leave(const std::uint32_t group_address) override { groups.erase(group_address); }
+
+  bool fail_join = false;
+  std::set<uint32_t> groups;
+};
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+TEST_CASE("TransportBase multi frame reassembly")
+{
+  static CanardPortID      constexpr PORT_ID               = 1234;
+  static size_t            constexpr MTU_BYTES             = 16;
+  static CanardMicrosecond constexpr TID_TIMEOUT_usec      = 2*1000*1000UL;
+
+  num_allocated = 0;
+  {
+    CanardInstance tx_canard = canardInit(test_allocate, test_free);
+    CanardInstance rx_canard = canardInit(test_allocate, test_free);
+    tx_canard.node_id = 10;
+    rx_canard.node_id = 20;
+
+    TestTransport tx(tx_canard, MTU_BYTES);
+    TestTransport rx(rx_canard, MTU_BYTES);
+    TestSubscription sub(rx_canard, CanardTransferKindMessage, PORT_ID, 256, TID_TIMEOUT_usec);
+
+    std::vector<uint8_t> payload(100);
+    std::iota(payload.begin(), payload.end(), 0);
+
+    CanardTransferMetadata metadata{CanardPriorityNominal, CanardTransferKindMessage, PORT_ID, CANARD_NODE_ID_UNSET, 0};
+    auto transmit = [&](CanardTransferID const transfer_id)
+    {
+      tx.frames.clear();
+      metadata.transfer_id = transfer_id;
+      REQUIRE(tx.transmit(metadata, payload.size(), payload.data()));
+      /* 100 bytes payload + 4 bytes CRC */
+      REQUIRE(tx.frames.size() == 7);
+    };
+    auto receive_all = [&](CanardMicrosecond const timestamp_usec)
+    {
+      for (auto & frame : tx.frames)
+        rx.receive(frame, timestamp_usec);
+    };
+
+    SECTION("frames received in order are reassembled")
+    {
+      transmit(0);
+      receive_all(1000);
+      REQUIRE(sub.transfers.size() == 1);
+      REQUIRE(sub.transfers[0].remote_node_id == 10);
+      REQUIRE(sub.transfers[0].payload == payload);
+    }
+
+    SECTION("the CRC split across the last two frames is verified")
+    {
+      payload.resize(14);
+      tx.frames.clear();
+      REQUIRE(tx.transmit(metadata, payload.size(), payload.data()));
+      REQUIRE(tx.frames.size() == 2);
+      REQUIRE(tx.frames[1].payload.size() == 2);
+      receive_all(1000);
+      REQUIRE(sub.transfers.size() == 1);
+      REQUIRE(sub.transfers[0].payload == payload);
+    }
+
+    SECTION("the payload is truncated to the extent of the subscription")
+    {
+      TestSubscription small_sub(rx_canard, CanardTransferKindMessage, PORT_ID + 1, 40, TID_TIMEOUT_usec);
+      metadata.port_id = PORT_ID + 1;
+      transmit(0);
+      receive_all(1000);
+      REQUIRE(small_sub.transfers.size() == 1);
+      REQUIRE(small_sub.transfers[0].payload == std::vector<uint8_t>(payload.begin(), payload.begin() + 40));
+    }
+
+    SECTION("a transfer with out-of-order frames is dropped")
+    {
+      transmit(0);
+      std::swap(tx.frames[2], tx.frames[3]);
+      receive_all(1000);
+      REQUIRE(sub.transfers.empty());
+
+      transmit(1);
+      receive_all(2000);
+      REQUIRE(sub.transfers.size() == 1);
+      REQUIRE(sub.transfers[0].transfer_id == 1);
+    }
+
+    SECTION("a transfer with a missing frame is dropped")
+    {
+      transmit(0);
+      tx.frames.erase(tx.frames.begin() + 4);
+      receive_all(1000);
+      REQUIRE(sub.transfers.empty());
+    }
+
+    SECTION("a transfer with a CRC mismatch is dropped")
+    {
+      transmit(0);
+      tx.frames[3].payload[5] ^= 0x01;
+      receive_all(1000);
+      REQUIRE(sub.transfers.empty());
+    }
+
+    SECTION("a transfer which is never completed is replaced by the next one")
+    {
+      transmit(0);
+      tx.frames.pop_back();
+      receive_all(1000);
+      REQUIRE(sub.transfers.empty());
+      REQUIRE(num_allocated == 1);
+
+      transmit(1);
+      receive_all(2000);
+      REQUIRE(sub.transfers.size() == 1);
+      REQUIRE(sub.transfers[0].transfer_id == 1);
+      REQUIRE(num_allocated == 0);
+    }
+
+    SECTION("a duplicated transfer is dropped until the transfer-ID timeout expired")
+    {
+      transmit(0);
+      receive_all(1000);
+      receive_all(1000 + TID_TIMEOUT_usec);
+      REQUIRE(sub.transfers.size() == 1);
+
+      receive_all(1000 + TID_TIMEOUT_usec + 1);
+      REQUIRE(sub.transfers.size() == 2);
+    }
+
+    SECTION("frames of another node do not interfere")
+    {
+      transmit(0);
+      std::vector<TestTransport::Frame> frames = tx.frames;
+      for (auto & frame : tx.frames)
+        frame.header.source_node_id = 11;
+      for (size_t i = 0; i < frames.size(); i++) {
+        rx.receive(frames[i], 1000);
+        rx.receive(tx.frames[i], 1000);
+      }
+      REQUIRE(sub.transfers.size() == 2);
+      REQUIRE(sub.transfers[0].remote_node_id == 10);
+      REQUIRE(sub.transfers[1].remote_node_id == 11);
+    }
+  }
+  /* Reassembly buffers are returned to the heap. */
+  REQUIRE(num_allocated == 0);
+}
+
+TEST_CASE("TransportBase transfer-ID extension")
+{
+  static CanardPortID constexpr SUBJECT_ID = 1234;
+  static CanardPortID constexpr SERVICE_ID = 430;
+
+  CanardInstance tx_canard = canardInit(test_allocate, test_free);
+  CanardInstance rx_canard = canardInit(test_allocate, test_free);
+  tx_canard.node_id = 10;
+  rx_canard.node_id = 20;
+
+  TestTransport tx(tx_canard, 1024);
+  TestTransport rx(rx_canard, 1024);
+
+  uint8_t const payload[] = {1, 2, 3};
+
+  auto transmit = [&](TestTransport & transport, CanardTransferKind const transfer_kind, CanardPortID const port_id, CanardNodeID const remote_node_id, CanardTransferID const transfer_id) -> uint64_t
+  {
+    transport.frames.clear();
+    CanardTransferMetadata const metadata{CanardPriorityNominal, transfer_kind, port_id, remote_node_id, transfer_id};
+    REQUIRE(transport.transmit(metadata, sizeof(payload), payload));
+    REQUIRE(transport.frames.size() == 1);
+    return transport.frames[0].header.transfer_id;
+  };
+
+  SECTION("the first transfer of a session starts at its 8 bit transfer-ID")
+  {
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 42) == 42);
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 43) == 43);
+  }
+
+  SECTION("transfer-IDs continue beyond the 8 bit range")
+  {
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 254) == 254);
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 255) == 255);
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 0) == 256);
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 1) == 257);
+    /* Skipped transfer-IDs are skipped in the extended transfer-ID, too. */
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 5) == 261);
+  }
+
+  SECTION("sessions are extended independently")
+  {
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 255) == 255);
+    REQUIRE(transmit(tx, CanardTransferKindRequest, SERVICE_ID, 20, 255) == 255);
+    REQUIRE(transmit(tx, CanardTransferKindRequest, SERVICE_ID, 21, 7) == 7);
+    REQUIRE(transmit(tx, CanardTransferKindMessage, SUBJECT_ID, CANARD_NODE_ID_UNSET, 0) == 256);
+    REQUIRE(transmit(tx, CanardTransferKindRequest, SERVICE_ID, 20, 0) == 256);
+    REQUIRE(transmit(tx, CanardTransferKindRequest, SERVICE_ID, 21, 8) == 8);
+  }
+
+  SECTION("a response carries the complete transfer-ID of the request")
+  {
+    TestSubscription req_sub(rx_canard, CanardTransferKindRequest, SERVICE_ID, 16, CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+
+    for (CanardTransferID tid = 250; tid != 3; tid++)
+      REQUIRE(transmit(tx, CanardTransferKindRequest, SERVICE_ID, 20, tid) >= 250);
+    REQUIRE(tx.frames[0].header.transfer_id == 258);
+    rx.receive(tx.frames[0], 1000);
+    REQUIRE(req_sub.transfers.size() == 1);
+    /* libcanard only sees the truncated transfer-ID. */
+    REQUIRE(req_sub.transfers[0].transfer_id == 2);
+
+    REQUIRE(transmit(rx, CanardTransferKindResponse, SERVICE_ID, 10, 2) == 258);
+  }
+
+  SECTION("a response to an unknown request carries the 8 bit transfer-ID")
+  {
+    REQUIRE(transmit(rx, CanardTransferKindResponse, SERVICE_ID, 10, 17) == 17);
+  }
+}
+
+TEST_CASE("UdpTransport service group")
+{
+  CanardInstance canard = canardInit(test_allocate, test_free);
+  canard.node_id = 20;
+
+  TestUdpSocket socket;
+  UdpTransport transport(canard, socket, 64);
+
+  uint32_t const service_group = UdpTransport::SERVICE_MULTICAST_PREFIX | 20;
+
+  SECTION("the service group is joined for the first and left after the last service port")
+  {
+    REQUIRE(transport.subscribe(CanardTransferKindRequest, 430));
+    REQUIRE(transport.subscribe(CanardTransferKindResponse, 430));
+    REQUIRE(socket.groups.count(service_group) == 1);
+
+    transport.unsubscribe(CanardTransferKindRequest, 430);
+    REQUIRE(socket.groups.count(service_group) == 1);
+    transport.unsubscribe(CanardTransferKindResponse, 430);
+    REQUIRE(socket.groups.empty());
+  }
+
+  SECTION("a failed subscription does not keep the service group joined")
+  {
+    socket.fail_join = true;
+    REQUIRE(!transport.subscribe(CanardTransferKindRequest, 430));
+    socket.fail_join = false;
+
+    REQUIRE(transport.subscribe(CanardTransferKindRequest, 431));
+    REQUIRE(socket.groups.count(service_group) == 1);
+    transport.unsubscribe(CanardTransferKindRequest, 431);
+    REQUIRE(socket.groups.empty());
+  }
+
+  SECTION("a failed subscription leaves no subject group joined")
+  {
+    socket.fail_join = true;
+    REQUIRE(!transport.subscribe(CanardTransferKindMessage, 1234));
+    socket.fail_join = false;
+
+    REQUIRE(transport.subscribe(CanardTransferKindMessage, 1234));
+    REQUIRE(socket.groups.count(UdpTransport::SUBJECT_MULTICAST_PREFIX | 1234) == 1);
+    transport.unsubscribe(CanardTransferKindMessage, 1234);
+    REQUIRE(socket.groups.empty());
+  }
+}
+
+} /* cyphal::impl */
@@ -0,0 +1,122 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/queue/TxStagingQueue.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+TEST_CASE("TxStagingQueue")
+{
+  TxStagingQueue queue;
+  CanardTransferMetadata metadata{};
+  metadata.port_id = 1234;
+
+  SECTION("staged transfers are drained in order with a copy of their payload")
+  {
+    std::array<uint8_t, 3> payload{1, 2, 3};
+    REQUIRE(queue.push(100, metadata, payload.size(), payload.data(), OnTransferTransmittedCb{}));
+    payload[0] = 4;
+    REQUIRE(queue.push(200, metadata, 1, payload.data(), OnTransferTransmittedCb{}));
+    REQUIRE(queue.push(300, metadata, 0, nullptr, OnTransferTransmittedCb{}));
+
+    std::vector<std::vector<uint8_t>> payloads;
+    std::vector<CanardMicrosecond> deadlines;
+    size_t const num_transfers = queue.drain([&](TxStagingQueue::Transfer const & transfer)
+                                             {
+                                               REQUIRE(transfer.metadata.port_id == 1234);
+                                               deadlines.push_back(transfer.tx_deadline_usec);
+                                               payloads.emplace_back(transfer.payload, transfer.payload + transfer.payload_size);
+                                             });
+
+    REQUIRE(num_transfers == 3);
+    REQUIRE(deadlines == std::vector<CanardMicrosecond>{100, 200, 300});
+    REQUIRE(payloads == std::vector<std::vector<uint8_t>>{{1, 2, 3}, {4}, {}});
+    REQUIRE(queue.drain([](TxStagingQueue::Transfer const &) { }) == 0);
+  }
+
+  SECTION("the completion callback is staged along with the transfer")
+  {
+    bool is_invoked = false;
+    REQUIRE(queue.push(100, metadata, 0, nullptr, [&is_invoked](CanardMicrosecond const) { is_invoked = true; }));
+    queue.drain([](TxStagingQueue::Transfer const & transfer) { transfer.on_transmitted_cb(0); });
+    REQUIRE(is_invoked);
+  }
+
+  SECTION("the completion callback is released once the transfer has been drained")
+  {
+    auto const state = std::make_shared<int>(0);
+    REQUIRE(queue.push(100, metadata, 0, nullptr, [state](CanardMicrosecond const) { }));
+    REQUIRE(state.use_count() == 2);
+    queue.drain([](TxStagingQueue::Transfer const &) { });
+    REQUIRE(state.use_count() == 1);
+  }
+
+  SECTION("payloads exceeding the maximum payload size are refused")
+  {
+    TxStagingQueue small_queue(4);
+    std::array<uint8_t, 5> const payload{1, 2, 3, 4, 5};
+    REQUIRE(small_queue.push(0, metadata, 4, payload.data(), OnTransferTransmittedCb{}));
+    REQUIRE_FALSE(small_queue.push(0, metadata, 5, payload.data(), OnTransferTransmittedCb{}));
+    REQUIRE(small_queue.drain([](TxStagingQueue::Transfer const & transfer) { REQUIRE(transfer.payload_size == 4); }) == 1);
+  }
+
+  SECTION("a full queue refuses further transfers")
+  {
+    uint8_t const payload = 0;
+    for (size_t i = 0; i < TxStagingQueue::CAPACITY; i++)
+      REQUIRE(queue.push(0, metadata, 1, &payload, OnTransferTransmittedCb{}));
+    REQUIRE_FALSE(queue.push(0, metadata, 1, &payload, OnTransferTransmittedCb{}));
+  }
+
+  SECTION("transfers staged by multiple threads are drained completely")
+  {
+    size_t constexpr NUM_THREADS = 4;
+    uint8_t constexpr NUM_TRANSFERS_PER_THREAD = 200;
+
+    std::vector<std::thread> producers;
+    for (size_t t = 0; t < NUM_THREADS; t++)
+      producers.emplace_back([&queue, t]()
+                             {
+                               CanardTransferMetadata producer_metadata{};
+                               producer_metadata.port_id = static_cast<CanardPortID>(t);
+                               for (uint8_t i = 0; i < NUM_TRANSFERS_PER_THREAD; i++)
+                                 while (!queue.push(0, producer_metadata, 1, &i, OnTransferTransmittedCb{}))
+                                   std::this_thread::yield();
+                             });
+
+    std::array<uint8_t, NUM_THREADS> next{};
+    bool is_ordered = true;
+    size_t num_drained = 0;
+    while (num_drained < NUM_THREADS * NUM_TRANSFERS_PER_THREAD)
+      num_drained += queue.drain([&](TxStagingQueue::Transfer const & transfer)
+                                 {
+                                   is_ordered &= (transfer.payload[0] == next[transfer.metadata.port_id]++);
+                                 });
+
+    for (auto & producer : producers)
+      producer.join();
+
+    REQUIRE(is_ordered);
+  }
+}
+
+} /* cyphal::impl */
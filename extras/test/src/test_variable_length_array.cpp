@@ -0,0 +1,185 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <util/array/VariableLengthArray.hpp>
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <iterator>
+
+/**************************************************************************************
+ * TEST CODE
+ **************************************************************************************/
+
+namespace cyphal::support
+{
+
+namespace
+{
+
+struct CountingAllocator
+{
+  static inline size_t num_allocations = 0;
+  static inline bool is_exhausted = false;
+
+  static void * allocate(size_t const amount)
+  {
+    if (is_exhausted)
+      return nullptr;
+    num_allocations++;
+    return std::malloc(amount);
+  }
+  static void free(void * const pointer)
+  {
+    num_allocations--;
+    std::free(pointer);
+  }
+};
+
+typedef SmallVariableLengthArray<uint8_t, 8, 2, CountingAllocator> SmallArray;
+
+}
+
+TEST_CASE("InlineVariableLengthArray")
+{
+  InlineVariableLengthArray<uint8_t, 4> arr;
+
+  SECTION("elements are appended up to the capacity")
+  {
+    REQUIRE(arr.empty());
+    REQUIRE(arr.capacity() == 4);
+    arr.reserve(100);
+    for (uint8_t i = 0; i < 6; i++)
+      arr.push_back(i);
+    REQUIRE(arr.size() == 4);
+    REQUIRE(std::vector<uint8_t>(arr.cbegin(), arr.cend()) == std::vector<uint8_t>{0, 1, 2, 3});
+    REQUIRE(arr.front() == 0);
+    REQUIRE(arr.back() == 3);
+    arr.pop_back();
+    REQUIRE(arr.size() == 3);
+    arr.clear();
+    REQUIRE(arr.empty());
+  }
+
+  SECTION("a std::back_inserter appends to the array")
+  {
+    std::string const name = "node";
+    std::copy(name.cbegin(), name.cend(), std::back_inserter(arr));
+    REQUIRE(std::string(arr.cbegin(), arr.cend()) == name);
+  }
+
+  SECTION("resize and assign are bounded by the capacity")
+  {
+    arr.resize(10, 7);
+    REQUIRE(arr == InlineVariableLengthArray<uint8_t, 4>{7, 7, 7, 7});
+    arr.resize(2);
+    REQUIRE(arr == InlineVariableLengthArray<uint8_t, 4>{7, 7});
+    arr.assign({1, 2, 3, 4, 5});
+    REQUIRE(arr == InlineVariableLengthArray<uint8_t, 4>{1, 2, 3, 4});
+    REQUIRE(arr != InlineVariableLengthArray<uint8_t, 4>{1, 2, 3});
+  }
+
+  SECTION("copies and moves transfer the elements")
+  {
+    InlineVariableLengthArray<std::string, 2> src{"a", "b"};
+
+    InlineVariableLengthArray<std::string, 2> copy = src;
+    REQUIRE(copy == src);
+
+    InlineVariableLengthArray<std::string, 2> moved = std::move(src);
+    REQUIRE(moved == copy);
+    REQUIRE(src.empty());
+
+    copy = InlineVariableLengthArray<std::string, 2>{"c"};
+    REQUIRE(copy.size() == 1);
+    REQUIRE(copy[0] == "c");
+  }
+
+  SECTION("elements are destroyed along with the array")
+  {
+    auto const element = std::make_shared<int>(0);
+    {
+      InlineVariableLengthArray<std::shared_ptr<int>, 3> elements;
+      elements.push_back(element);
+      elements.emplace_back(element);
+      REQUIRE(element.use_count() == 3);
+    }
+    REQUIRE(element.use_count() == 1);
+  }
+}
+
+TEST_CASE("SmallVariableLengthArray")
+{
+  CountingAllocator::num_allocations = 0;
+  CountingAllocator::is_exhausted = false;
+
+  SECTION("elements exceeding the inline storage are moved onto the heap")
+  {
+    SmallArray arr{1, 2};
+    REQUIRE(arr.is_inline());
+    REQUIRE(CountingAllocator::num_allocations == 0);
+
+    arr.push_back(3);
+    REQUIRE_FALSE(arr.is_inline());
+    REQUIRE(CountingAllocator::num_allocations == 1);
+    REQUIRE(arr == SmallArray{1, 2, 3});
+  }
+
+  SECTION("reserving allocates the required capacity at once, bounded by the maximum size")
+  {
+    SmallArray arr;
+    arr.reserve(5);
+    REQUIRE(arr.capacity() == 5);
+    arr.reserve(100);
+    REQUIRE(arr.capacity() == 8);
+    REQUIRE(CountingAllocator::num_allocations == 1);
+    for (uint8_t i = 0; i < 10; i++)
+      arr.push_back(i);
+    REQUIRE(arr.size() == 8);
+  }
+
+  SECTION("moving an array takes over its heap buffer")
+  {
+    SmallArray src{1, 2, 3, 4};
+    uint8_t const * const data = src.data();
+
+    SmallArray dst = std::move(src);
+    REQUIRE(dst.data() == data);
+    REQUIRE(src.empty());
+    REQUIRE(CountingAllocator::num_allocations == 1);
+
+    SmallArray copy = dst;
+    REQUIRE(copy == dst);
+    REQUIRE(CountingAllocator::num_allocations == 2);
+  }
+
+  SECTION("elements are discarded if the heap is exhausted")
+  {
+    CountingAllocator::is_exhausted = true;
+    SmallArray arr{1, 2, 3};
+    REQUIRE(arr == SmallArray{1, 2});
+  }
+
+  REQUIRE(CountingAllocator::num_allocations == 0);
+}
+
+TEST_CASE("smallBufferInlineSize")
+{
+  REQUIRE(smallBufferInlineSize<uint8_t, 50>() == 50);
+  REQUIRE(smallBufferInlineSize<uint8_t, 256>() == CYPHAL_SMALL_BUFFER_INLINE_BYTES);
+  REQUIRE(smallBufferInlineSize<uint64_t, 32>() == CYPHAL_SMALL_BUFFER_INLINE_BYTES / 8);
+  REQUIRE(smallBufferInlineSize<std::array<uint8_t, 100>, 4>() == 1);
+}
+
+} /* cyphal::support */
@@ -17,4 +17,28 @@
 #include "Subscription.hpp"
 #include "ServiceClient.hpp"
 #include "ServiceServer.hpp"
+#include "ConstResponseServiceServer.hpp"
+#include "util/coro/Task.hpp"
+#include "util/coro/AsyncServiceClient.hpp"
+#include "util/nodeinfo/NodeInfoBase.hpp"
+#include "util/registry/registry_impl.hpp"
+#include "util/storage/KeyValueStorage.hpp"
+#include "util/pnp/PnpClientBase.hpp"
+#include "util/pnp/PnpServerBase.hpp"
+#include "util/file/FileServerBase.hpp"
+#include "util/file/FileReadClientBase.hpp"
+#include "util/update/SoftwareUpdaterBase.hpp"
+#include "util/log/LoggerBase.hpp"
+#include "util/capture/CanCaptureBase.hpp"
+#include "util/bridge/CanBridgeBase.hpp"
+#include "util/port/PortListPublisherBase.hpp"
+#include "util/time/TimeSyncBase.hpp"
+#include "util/file/FileSource.hpp"
+#include "util/file/FileSink.hpp"
+#include "util/transport/udp/UdpSocket.hpp"
+#include "util/transport/serial/SerialPort.hpp"
+#include "util/view/PortListView.hpp"
+#include "util/view/RegisterAccessResponseView.hpp"
 #include "util/storage/register_storage.hpp"
+#include "util/capture/CaptureReplayer.hpp"
+#include "util/capture/CaptureExport.hpp"
@@ -0,0 +1,54 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "libcanard/canard.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Base class for all components observing the raw CAN frames
+ * received or transmitted by a node. Received frames are passed
+ * from within Node::onCanFrameReceived(), i.e. possibly from
+ * interrupt context, hence implementations shall only copy the
+ * frame into a lock-free queue.
+ */
+class CanFrameTapBase
+{
+public:
+  CanFrameTapBase() = default;
+  virtual ~CanFrameTapBase() { }
+  CanFrameTapBase(CanFrameTapBase const &) = delete;
+  CanFrameTapBase(CanFrameTapBase &&) = delete;
+  CanFrameTapBase &operator=(CanFrameTapBase const &) = delete;
+  CanFrameTapBase &operator=(CanFrameTapBase &&) = delete;
+
+  virtual void onCanFrame(CanardFrame const & frame, CanardMicrosecond const timestamp_usec, bool const is_tx) = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
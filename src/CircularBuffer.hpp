@@ -49,11 +49,11 @@ public:
   void enqueue(T const & val);
   T * peek();
   void pop();
-
+  size_t size() const { return _num_elems; }
 
 
 private:
-  std::unique_ptr<T> _buffer;
+  std::unique_ptr<T[]> _buffer;
   size_t _size, _head, _tail, _num_elems;
 
   bool isFull() const { return (_num_elems == _size); }
@@ -45,7 +45,7 @@ void CircularBuffer<T>::enqueue(T const & val)
 {
   if (isFull()) return;
 
-  _buffer.get()[_head] = val;
+  _buffer[_head] = val;
   _head = nextIndex(_head);
   _num_elems++;
 }
@@ -55,7 +55,7 @@ T * CircularBuffer<T>::peek()
 {
   if (isEmpty()) return nullptr;
 
-  T * val_ptr = &(_buffer.get()[_tail]);
+  T * val_ptr = &(_buffer[_tail]);
   return val_ptr;
 }
 
@@ -0,0 +1,76 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include "ConstResponseServiceServerBase.hpp"
+
+#include <array>
+#include <optional>
+
+#include "Node.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Answers every request with the same response, which is serialized
+ * once when updated rather than for each request. The requests are
+ * not deserialized.
+ */
+template<typename T_REQ, typename T_RSP>
+class ConstResponseServiceServer final : public ConstResponseServiceServerBase<T_RSP>
+{
+public:
+  ConstResponseServiceServer(Node & node_hdl, CanardPortID const request_port_id, CanardMicrosecond const tx_timeout_usec)
+  : _node_hdl{node_hdl}
+  , _request_port_id{request_port_id}
+  , _tx_timeout_usec{tx_timeout_usec}
+  , _rsp_buf{}
+  , _rsp_size{std::nullopt}
+  { }
+  virtual ~ConstResponseServiceServer();
+
+
+  bool update(T_RSP const & rsp) override;
+  bool onTransferReceived(CanardRxTransfer const & transfer) override;
+
+
+private:
+  Node & _node_hdl;
+  CanardPortID const _request_port_id;
+  CanardMicrosecond const _tx_timeout_usec;
+  std::array<uint8_t, T_RSP::_traits_::SerializationBufferSizeBytes> _rsp_buf;
+  std::optional<size_t> _rsp_size;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
+
+/**************************************************************************************
+ * TEMPLATE IMPLEMENTATION
+ **************************************************************************************/
+
+#include "ConstResponseServiceServer.ipp"
@@ -0,0 +1,83 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#undef max
+#undef min
+#include <nunavut/support/serialization.hpp>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CTOR/DTOR
+ **************************************************************************************/
+
+template<typename T_REQ, typename T_RSP>
+ConstResponseServiceServer<T_REQ, T_RSP>::~ConstResponseServiceServer()
+{
+  _node_hdl.unsubscribe(_request_port_id, SubscriptionBase::canard_transfer_kind(), *this);
+}
+
+/**************************************************************************************
+ * PUBLIC MEMBER FUNCTIONS
+ **************************************************************************************/
+
+template<typename T_REQ, typename T_RSP>
+bool ConstResponseServiceServer<T_REQ, T_RSP>::update(T_RSP const & rsp)
+{
+  /* Requests are left unanswered if the response can not be serialized. */
+  _rsp_size = std::nullopt;
+
+  nunavut::support::bitspan rsp_buf_bitspan{_rsp_buf};
+  auto const rsp_rc = serialize(rsp, rsp_buf_bitspan);
+  if (!rsp_rc) return false;
+
+  _rsp_size = *rsp_rc;
+  return true;
+}
+
+template<typename T_REQ, typename T_RSP>
+bool ConstResponseServiceServer<T_REQ, T_RSP>::onTransferReceived(CanardRxTransfer const & transfer)
+{
+  if (!_rsp_size.has_value()) return false;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+  CanardTransferMetadata const transfer_metadata =
+  {
+    .priority       = CanardPriorityNominal,
+    .transfer_kind  = CanardTransferKindResponse,
+    .port_id        = transfer.metadata.port_id,
+    .remote_node_id = transfer.metadata.remote_node_id,
+    .transfer_id    = transfer.metadata.transfer_id,
+  };
+#pragma GCC diagnostic pop
+
+  /* Enqueue the cached response. */
+  return _node_hdl.enqueue_transfer(_tx_timeout_usec,
+                                    &transfer_metadata,
+                                    _rsp_size.value(),
+                                    _rsp_buf.data());
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
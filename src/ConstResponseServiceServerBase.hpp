@@ -0,0 +1,58 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <memory>
+
+#include "ServiceServerBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+template <typename T_RSP>
+class ConstResponseServiceServerBase : public ServiceServerBase
+{
+public:
+  virtual ~ConstResponseServiceServerBase() { }
+  /* Replaces the response sent to all subsequent requests. */
+  virtual bool update(T_RSP const & rsp) = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+template <typename T_RSP>
+using ConstResponseServiceServer = std::shared_ptr<impl::ConstResponseServiceServerBase<T_RSP>>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
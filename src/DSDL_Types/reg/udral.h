@@ -0,0 +1,12 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "udral/physics.h"
+#include "udral/service.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,17 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "physics/acoustics.h"
+#include "physics/dynamics.h"
+#include "physics/electricity.h"
+#include "physics/kinematics.h"
+#include "physics/optics.h"
+#include "physics/thermodynamics.h"
+#include "physics/time.h"
+#pragma GCC diagnostic pop
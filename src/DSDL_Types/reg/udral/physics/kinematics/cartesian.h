@@ -0,0 +1,24 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/reg/udral/physics/kinematics/cartesian/PointStateVarTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/PointStateVar_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/PointState_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/PointVar_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/Point_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/PoseVarTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/PoseVar_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/Pose_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/StateVarTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/StateVar_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/State_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/TwistVarTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/TwistVar_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/cartesian/Twist_0_1.hpp>
+#pragma GCC diagnostic pop
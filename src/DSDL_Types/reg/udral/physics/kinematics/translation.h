@@ -0,0 +1,16 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/reg/udral/physics/kinematics/translation/LinearTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/translation/LinearVarTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/translation/Linear_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/translation/Velocity1VarTs_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/translation/Velocity3Var_0_1.hpp>
+#include <types/reg/udral/physics/kinematics/translation/Velocity3Var_0_2.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,13 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/reg/udral/physics/time/TAI64VarTs_0_1.hpp>
+#include <types/reg/udral/physics/time/TAI64Var_0_1.hpp>
+#include <types/reg/udral/physics/time/TAI64_0_1.hpp>
+#pragma GCC diagnostic pop
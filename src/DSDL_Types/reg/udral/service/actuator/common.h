@@ -0,0 +1,15 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/reg/udral/service/actuator/common/FaultFlags_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/Feedback_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/Status_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/zX005FzX005F0_1.hpp>
+#include "common/sp.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,18 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/reg/udral/service/actuator/common/sp/Scalar_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/Vector2_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/Vector31_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/Vector3_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/Vector4_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/Vector6_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/Vector8_0_1.hpp>
+#include <types/reg/udral/service/actuator/common/sp/zX005FzX005F0_1.hpp>
+#pragma GCC diagnostic pop
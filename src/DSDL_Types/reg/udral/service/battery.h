@@ -0,0 +1,15 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/reg/udral/service/battery/Error_0_1.hpp>
+#include <types/reg/udral/service/battery/Parameters_0_3.hpp>
+#include <types/reg/udral/service/battery/Status_0_2.hpp>
+#include <types/reg/udral/service/battery/Technology_0_1.hpp>
+#include <types/reg/udral/service/battery/zX005FzX005F0_1.hpp>
+#pragma GCC diagnostic pop
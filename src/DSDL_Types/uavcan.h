@@ -0,0 +1,20 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "uavcan/_register.h"
+#include "uavcan/diagnostic.h"
+#include "uavcan/file.h"
+#include "uavcan/internet.h"
+#include "uavcan/metatransport.h"
+#include "uavcan/node.h"
+#include "uavcan/pnp.h"
+#include "uavcan/primitive.h"
+#include "uavcan/si.h"
+#include "uavcan/time.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,14 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/_register/Access_1_0.hpp>
+#include <types/uavcan/_register/List_1_0.hpp>
+#include <types/uavcan/_register/Name_1_0.hpp>
+#include <types/uavcan/_register/Value_1_0.hpp>
+#pragma GCC diagnostic pop
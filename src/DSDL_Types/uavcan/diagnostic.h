@@ -0,0 +1,13 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/diagnostic/Record_1_0.hpp>
+#include <types/uavcan/diagnostic/Record_1_1.hpp>
+#include <types/uavcan/diagnostic/Severity_1_0.hpp>
+#pragma GCC diagnostic pop
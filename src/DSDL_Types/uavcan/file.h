@@ -0,0 +1,23 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/file/Error_1_0.hpp>
+#include <types/uavcan/file/GetInfo_0_1.hpp>
+#include <types/uavcan/file/GetInfo_0_2.hpp>
+#include <types/uavcan/file/List_0_1.hpp>
+#include <types/uavcan/file/List_0_2.hpp>
+#include <types/uavcan/file/Modify_1_0.hpp>
+#include <types/uavcan/file/Modify_1_1.hpp>
+#include <types/uavcan/file/Path_1_0.hpp>
+#include <types/uavcan/file/Path_2_0.hpp>
+#include <types/uavcan/file/Read_1_0.hpp>
+#include <types/uavcan/file/Read_1_1.hpp>
+#include <types/uavcan/file/Write_1_0.hpp>
+#include <types/uavcan/file/Write_1_1.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,20 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/metatransport/can/ArbitrationID_0_1.hpp>
+#include <types/uavcan/metatransport/can/BaseArbitrationID_0_1.hpp>
+#include <types/uavcan/metatransport/can/DataClassic_0_1.hpp>
+#include <types/uavcan/metatransport/can/DataFD_0_1.hpp>
+#include <types/uavcan/metatransport/can/Error_0_1.hpp>
+#include <types/uavcan/metatransport/can/ExtendedArbitrationID_0_1.hpp>
+#include <types/uavcan/metatransport/can/Frame_0_1.hpp>
+#include <types/uavcan/metatransport/can/Frame_0_2.hpp>
+#include <types/uavcan/metatransport/can/Manifestation_0_1.hpp>
+#include <types/uavcan/metatransport/can/RTR_0_1.hpp>
+#pragma GCC diagnostic pop
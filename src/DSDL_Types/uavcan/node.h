@@ -0,0 +1,23 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/node/ExecuteCommand_1_0.hpp>
+#include <types/uavcan/node/ExecuteCommand_1_1.hpp>
+#include <types/uavcan/node/ExecuteCommand_1_2.hpp>
+#include <types/uavcan/node/ExecuteCommand_1_3.hpp>
+#include <types/uavcan/node/GetInfo_1_0.hpp>
+#include <types/uavcan/node/GetTransportStatistics_0_1.hpp>
+#include <types/uavcan/node/Health_1_0.hpp>
+#include <types/uavcan/node/Heartbeat_1_0.hpp>
+#include <types/uavcan/node/ID_1_0.hpp>
+#include <types/uavcan/node/IOStatistics_0_1.hpp>
+#include <types/uavcan/node/Mode_1_0.hpp>
+#include <types/uavcan/node/Version_1_0.hpp>
+#include "node/port.h"
+#pragma GCC diagnostic pop
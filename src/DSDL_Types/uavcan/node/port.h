@@ -0,0 +1,19 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/node/port/ID_1_0.hpp>
+#include <types/uavcan/node/port/List_0_1.hpp>
+#include <types/uavcan/node/port/List_1_0.hpp>
+#include <types/uavcan/node/port/ServiceIDList_0_1.hpp>
+#include <types/uavcan/node/port/ServiceIDList_1_0.hpp>
+#include <types/uavcan/node/port/ServiceID_1_0.hpp>
+#include <types/uavcan/node/port/SubjectIDList_0_1.hpp>
+#include <types/uavcan/node/port/SubjectIDList_1_0.hpp>
+#include <types/uavcan/node/port/SubjectID_1_0.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,15 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/primitive/Empty_1_0.hpp>
+#include <types/uavcan/primitive/String_1_0.hpp>
+#include <types/uavcan/primitive/Unstructured_1_0.hpp>
+#include "primitive/array.h"
+#include "primitive/scalar.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,22 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/primitive/array/Bit_1_0.hpp>
+#include <types/uavcan/primitive/array/Integer16_1_0.hpp>
+#include <types/uavcan/primitive/array/Integer32_1_0.hpp>
+#include <types/uavcan/primitive/array/Integer64_1_0.hpp>
+#include <types/uavcan/primitive/array/Integer8_1_0.hpp>
+#include <types/uavcan/primitive/array/Natural16_1_0.hpp>
+#include <types/uavcan/primitive/array/Natural32_1_0.hpp>
+#include <types/uavcan/primitive/array/Natural64_1_0.hpp>
+#include <types/uavcan/primitive/array/Natural8_1_0.hpp>
+#include <types/uavcan/primitive/array/Real16_1_0.hpp>
+#include <types/uavcan/primitive/array/Real32_1_0.hpp>
+#include <types/uavcan/primitive/array/Real64_1_0.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,22 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/primitive/scalar/Bit_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Integer16_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Integer32_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Integer64_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Integer8_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Natural16_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Natural32_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Natural64_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Natural8_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Real16_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Real32_1_0.hpp>
+#include <types/uavcan/primitive/scalar/Real64_1_0.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,33 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "sample/acceleration.h"
+#include "sample/angle.h"
+#include "sample/angular_acceleration.h"
+#include "sample/angular_velocity.h"
+#include "sample/duration.h"
+#include "sample/electric_charge.h"
+#include "sample/electric_current.h"
+#include "sample/energy.h"
+#include "sample/force.h"
+#include "sample/frequency.h"
+#include "sample/length.h"
+#include "sample/luminance.h"
+#include "sample/magnetic_field_strength.h"
+#include "sample/magnetic_flux_density.h"
+#include "sample/mass.h"
+#include "sample/power.h"
+#include "sample/pressure.h"
+#include "sample/temperature.h"
+#include "sample/torque.h"
+#include "sample/velocity.h"
+#include "sample/voltage.h"
+#include "sample/volume.h"
+#include "sample/volumetric_flow_rate.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,33 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "unit/acceleration.h"
+#include "unit/angle.h"
+#include "unit/angular_acceleration.h"
+#include "unit/angular_velocity.h"
+#include "unit/duration.h"
+#include "unit/electric_charge.h"
+#include "unit/electric_current.h"
+#include "unit/energy.h"
+#include "unit/force.h"
+#include "unit/frequency.h"
+#include "unit/length.h"
+#include "unit/luminance.h"
+#include "unit/magnetic_field_strength.h"
+#include "unit/magnetic_flux_density.h"
+#include "unit/mass.h"
+#include "unit/power.h"
+#include "unit/pressure.h"
+#include "unit/temperature.h"
+#include "unit/torque.h"
+#include "unit/velocity.h"
+#include "unit/voltage.h"
+#include "unit/volume.h"
+#include "unit/volumetric_flow_rate.h"
+#pragma GCC diagnostic pop
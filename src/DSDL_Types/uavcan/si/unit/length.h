@@ -0,0 +1,14 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/si/unit/length/Scalar_1_0.hpp>
+#include <types/uavcan/si/unit/length/Vector3_1_0.hpp>
+#include <types/uavcan/si/unit/length/WideScalar_1_0.hpp>
+#include <types/uavcan/si/unit/length/WideVector3_1_0.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,15 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/uavcan/time/GetSynchronizationMasterInfo_0_1.hpp>
+#include <types/uavcan/time/Synchronization_1_0.hpp>
+#include <types/uavcan/time/SynchronizedTimestamp_1_0.hpp>
+#include <types/uavcan/time/TAIInfo_0_1.hpp>
+#include <types/uavcan/time/TimeSystem_0_1.hpp>
+#pragma GCC diagnostic pop
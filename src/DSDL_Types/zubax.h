@@ -0,0 +1,17 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "zubax/bridge.h"
+#include "zubax/fluxgrip.h"
+#include "zubax/low_level_io.h"
+#include "zubax/physics.h"
+#include "zubax/primitive.h"
+#include "zubax/service.h"
+#include "zubax/telega.h"
+#pragma GCC diagnostic pop
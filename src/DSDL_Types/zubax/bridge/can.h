@@ -0,0 +1,22 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/bridge/can/BaseFilterConfig_1_0.hpp>
+#include <types/zubax/bridge/can/BusErrorCounters_1_0.hpp>
+#include <types/zubax/bridge/can/ConfigResult_1_0.hpp>
+#include <types/zubax/bridge/can/Configuration_1_0.hpp>
+#include <types/zubax/bridge/can/ExtendedFilterConfig_1_0.hpp>
+#include <types/zubax/bridge/can/FaultConfinementStatus_1_0.hpp>
+#include <types/zubax/bridge/can/FilterConfig_1_0.hpp>
+#include <types/zubax/bridge/can/FrameCounters_1_0.hpp>
+#include <types/zubax/bridge/can/FrameTs_0_1.hpp>
+#include <types/zubax/bridge/can/PhysicalConfig_1_0.hpp>
+#include <types/zubax/bridge/can/Status_1_0.hpp>
+#include <types/zubax/bridge/can/TimingConfig_1_0.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,16 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/physics/electricity/PowerTs_0_1.hpp>
+#include <types/zubax/physics/electricity/PowerTs_1_0.hpp>
+#include <types/zubax/physics/electricity/Power_0_1.hpp>
+#include <types/zubax/physics/electricity/Power_1_0.hpp>
+#include <types/zubax/physics/electricity/SourceTs_1_0.hpp>
+#include <types/zubax/physics/electricity/Source_1_0.hpp>
+#pragma GCC diagnostic pop
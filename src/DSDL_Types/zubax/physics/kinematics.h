@@ -0,0 +1,23 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/physics/kinematics/DoF2ndTs_0_1.hpp>
+#include <types/zubax/physics/kinematics/DoF2ndTs_1_0.hpp>
+#include <types/zubax/physics/kinematics/DoF2nd_0_1.hpp>
+#include <types/zubax/physics/kinematics/DoF2nd_1_0.hpp>
+#include <types/zubax/physics/kinematics/DoF3rdTs_0_1.hpp>
+#include <types/zubax/physics/kinematics/DoF3rdTs_1_0.hpp>
+#include <types/zubax/physics/kinematics/DoF3rdVarTs_1_0.hpp>
+#include <types/zubax/physics/kinematics/DoF3rd_0_1.hpp>
+#include <types/zubax/physics/kinematics/DoF3rd_1_0.hpp>
+#include <types/zubax/physics/kinematics/Velocity1VarTs_1_0.hpp>
+#include <types/zubax/physics/kinematics/Velocity3Var_1_0.hpp>
+#include "kinematics/cartesian.h"
+#include "kinematics/geodetic.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,20 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/physics/kinematics/geodetic/PointStateVarTs_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/PointStateVar_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/PointState_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/PointVar_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/Point_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/PoseVar_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/Pose_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/StateVarTs_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/StateVar_0_1.hpp>
+#include <types/zubax/physics/kinematics/geodetic/State_0_1.hpp>
+#pragma GCC diagnostic pop
@@ -0,0 +1,15 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/primitive/zX005FzX005F1_0.hpp>
+#include "primitive/integer14.h"
+#include "primitive/natural9.h"
+#include "primitive/real16.h"
+#include "primitive/real32.h"
+#pragma GCC diagnostic pop
@@ -0,0 +1,19 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/telega/CompactFeedback_0_1.hpp>
+#include <types/zubax/telega/CompactFeedback_1_0.hpp>
+#include <types/zubax/telega/DQ_0_1.hpp>
+#include <types/zubax/telega/DQ_1_0.hpp>
+#include <types/zubax/telega/ServoCommand_0_1.hpp>
+#include <types/zubax/telega/ServoCommand_1_0.hpp>
+#include <types/zubax/telega/Temperatures_0_1.hpp>
+#include <types/zubax/telega/Temperatures_1_0.hpp>
+#include "telega/setpoint.h"
+#pragma GCC diagnostic pop
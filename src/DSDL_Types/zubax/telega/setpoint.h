@@ -0,0 +1,14 @@
+/* Generated by extras/script/generate_dsdl_umbrella_headers.sh, do not edit. */
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wtype-limits"
+#pragma GCC diagnostic ignored "-Wattributes"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <types/zubax/telega/setpoint/Raw14x36_0_1.hpp>
+#include <types/zubax/telega/setpoint/Raw14x4_0_1.hpp>
+#include <types/zubax/telega/setpoint/Raw9x56_0_1.hpp>
+#include <types/zubax/telega/setpoint/Raw9x6_0_1.hpp>
+#pragma GCC diagnostic pop
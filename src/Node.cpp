@@ -12,10 +12,28 @@
 #include "Node.hpp"
 
 #include <cstring>
+#include <algorithm>
 
 #include "util/nodeinfo/NodeInfo.hpp"
 #include "util/registry/Registry.hpp"
+#include "util/pnp/PnpClient.hpp"
+#include "util/pnp/PnpServer.hpp"
+#include "util/file/FileServer.hpp"
+#include "util/file/FileReadClient.hpp"
+#include "util/update/SoftwareUpdater.hpp"
+#include "util/log/Logger.hpp"
+#include "util/capture/CanCapture.hpp"
+#include "util/bridge/CanBridge.hpp"
 #include "util/port/PortListPublisher.hpp"
+#include "util/port/SubjectDispatcher.hpp"
+#include "util/time/TimeSyncMaster.hpp"
+#include "util/time/TimeSyncSlave.hpp"
+#include "util/queue/TxStagingQueue.hpp"
+#include "util/queue/DispatchQueue.hpp"
+#include "util/executor/ExecutorBase.hpp"
+#include "util/transport/TransportBase.hpp"
+#include "util/transport/udp/UdpTransport.hpp"
+#include "util/transport/serial/SerialTransport.hpp"
 
 /**************************************************************************************
  * NAMESPACE
@@ -44,17 +62,74 @@ Node::Node(uint8_t * heap_ptr,
 , _canard_rx_queue{(mtu_bytes == CANARD_MTU_CAN_CLASSIC) ? static_cast<CircularBufferBase *>(new CircularBufferCan(rx_queue_capacity)) : static_cast<CircularBufferBase *>(new CircularBufferCanFd(rx_queue_capacity))}
 , _mtu_bytes{mtu_bytes}
 , _opt_port_list_pub{std::nullopt}
+, _updatables{}
+, _time_sync{nullptr}
+, _can_frame_taps{}
+, _tx_completion_items{}
+, _transport{}
+, _tx_staging_queue{}
+, _dispatch_queue{}
+, _dispatch_budget_usec{0}
+, _subject_dispatchers{}
 {
   _canard_hdl.node_id = node_id;
   _canard_hdl.user_reference = static_cast<void *>(_o1heap_ins);
 
   _opt_port_list_pub = std::make_shared<impl::PortListPublisher>(*this, _micros_func);
+  _tx_completion_items.reserve(MAX_PENDING_TX_COMPLETIONS);
 }
 
+/* The CAN queues remain empty and unused. */
+Node::Node(uint8_t * heap_ptr,
+           size_t const heap_size,
+           MicrosFunc const micros_func,
+           support::platform::udp::interface::UdpSocket & udp_socket,
+           CanardNodeID const node_id,
+           size_t const mtu_bytes)
+: Node(heap_ptr, heap_size, micros_func, CanFrameTxFunc{}, node_id, 0, 0, mtu_bytes)
+{
+  _transport = std::make_unique<impl::UdpTransport>(_canard_hdl, udp_socket, mtu_bytes);
+}
+
+Node::Node(uint8_t * heap_ptr,
+           size_t const heap_size,
+           MicrosFunc const micros_func,
+           support::platform::serial::interface::SerialPort & serial_port,
+           CanardNodeID const node_id,
+           size_t const mtu_bytes)
+: Node(heap_ptr, heap_size, micros_func, CanFrameTxFunc{}, node_id, 0, 0, mtu_bytes)
+{
+  _transport = std::make_unique<impl::SerialTransport>(_canard_hdl, serial_port, mtu_bytes);
+}
+
+/* Defined here, where the types owned via std::unique_ptr are complete. */
+Node::~Node() = default;
+
 /**************************************************************************************
  * PUBLIC MEMBER FUNCTIONS
  **************************************************************************************/
 
+void Node::enable_tx_staging(size_t const max_payload_size)
+{
+  if (!_tx_staging_queue)
+    _tx_staging_queue = std::make_unique<impl::TxStagingQueue>(max_payload_size);
+}
+
+void Node::enable_deferred_dispatch(size_t const capacity, CanardMicrosecond const budget_usec)
+{
+  if (!_dispatch_queue)
+    _dispatch_queue = std::make_unique<impl::DispatchQueue>(_canard_hdl, capacity);
+  _dispatch_budget_usec = budget_usec;
+
+  if (_transport)
+    _transport->setDispatchQueue(_dispatch_queue.get());
+}
+
+uint32_t Node::dispatch_dropped() const
+{
+  return _dispatch_queue ? _dispatch_queue->dropped() : 0;
+}
+
 #if !defined(__GNUC__) || (__GNUC__ >= 11)
 Registry Node::create_registry()
 {
@@ -95,11 +170,184 @@ NodeInfo Node::create_node_info(uint8_t const protocol_major, uint8_t const prot
                                           name, image_crc);
 }
 
+PnpClient Node::create_pnp_client(std::array<uint8_t, 16> const & unique_id)
+{
+  return std::make_shared<impl::PnpClient>(*this, _micros_func, unique_id, _mtu_bytes);
+}
+
+#if !defined(__GNUC__) || (__GNUC__ >= 11)
+PnpServer Node::create_pnp_server(support::platform::storage::interface::KeyValueStorage & kv_storage)
+{
+  return std::make_shared<impl::PnpServer>(*this, kv_storage);
+}
+#endif
+
+TimeSync Node::create_time_sync_master()
+{
+  return std::make_shared<impl::TimeSyncMaster>(*this, _micros_func);
+}
+
+TimeSync Node::create_time_sync_slave()
+{
+  return std::make_shared<impl::TimeSyncSlave>(*this);
+}
+
+FileServer Node::create_file_server(support::platform::file::interface::FileSource & file_source)
+{
+  typedef impl::FileServer::TReadRequest TReadRequest;
+
+  addToPortList(TReadRequest::_traits_::FixedPortId, CanardTransferKindRequest, false);
+
+  auto srv = std::make_shared<impl::FileServer>(*this, file_source);
+
+  int8_t const rc = subscribe(CanardTransferKindRequest,
+                              TReadRequest::_traits_::FixedPortId,
+                              TReadRequest::_traits_::ExtentBytes,
+                              CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
+                              &(srv->canard_rx_subscription()));
+  if (rc < 0)
+    return nullptr;
+
+  return srv;
+}
+
+FileReadClient Node::create_file_read_client(CanardNodeID const server_node_id,
+                                             std::string const & path,
+                                             support::platform::file::interface::FileSink & file_sink,
+                                             size_t const window_size)
+{
+  typedef impl::FileReadClient::TReadResponse TReadResponse;
+
+  addToPortList(TReadResponse::_traits_::FixedPortId, CanardTransferKindResponse, false);
+
+  auto clt = std::make_shared<impl::FileReadClient>(*this, _micros_func, server_node_id, path, file_sink, window_size);
+
+  int8_t const rc = subscribe(CanardTransferKindResponse,
+                              TReadResponse::_traits_::FixedPortId,
+                              TReadResponse::_traits_::ExtentBytes,
+                              CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
+                              &(clt->canard_rx_subscription()));
+  if (rc < 0)
+    return nullptr;
+
+  return clt;
+}
+
+SoftwareUpdater Node::create_software_updater(FileServer file_server,
+                                              std::string const & image_path,
+                                              std::vector<CanardNodeID> const & node_ids,
+                                              size_t const max_concurrent_updates,
+                                              CanardMicrosecond const start_interval_usec)
+{
+  return std::make_shared<impl::SoftwareUpdater>(*this,
+                                                 _micros_func,
+                                                 file_server,
+                                                 image_path,
+                                                 node_ids,
+                                                 max_concurrent_updates,
+                                                 start_interval_usec);
+}
+
+Logger Node::create_logger()
+{
+  addToPortList(impl::Logger::TRecord::_traits_::FixedPortId, CanardTransferKindMessage, true);
+
+  return std::make_shared<impl::Logger>(*this, _micros_func);
+}
+
+CanCapture Node::create_can_capture(support::platform::file::interface::FileSink & file_sink)
+{
+  auto cap = std::make_shared<impl::CanCapture>(*this, file_sink);
+
+  if (!add_can_frame_tap(cap.get()))
+    return nullptr;
+
+  return cap;
+}
+
+CanBridge Node::create_can_bridge(Node & bus_node,
+                                  CanardPortID const tx_subject_id,
+                                  CanardPortID const rx_subject_id,
+                                  uint16_t const max_frames_per_second)
+{
+  if (&bus_node == this)
+    return nullptr;
+
+  addToPortList(tx_subject_id, CanardTransferKindMessage, true);
+  addToPortList(rx_subject_id, CanardTransferKindMessage, false);
+
+  auto bridge = std::make_shared<impl::CanBridge>(*this, _micros_func, bus_node, tx_subject_id, rx_subject_id, max_frames_per_second);
+
+  int8_t const rc = subscribe(CanardTransferKindMessage,
+                              rx_subject_id,
+                              impl::CanBridge::TFrame::_traits_::ExtentBytes,
+                              CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC,
+                              &(bridge->canard_rx_subscription()));
+  if (rc < 0)
+    return nullptr;
+
+  if (!bus_node.add_can_frame_tap(bridge.get()))
+    return nullptr;
+
+  return bridge;
+}
+
+Executor Node::create_executor()
+{
+  return std::make_shared<impl::ExecutorBase>();
+}
+
+std::optional<CanardMicrosecond> Node::synchronized_micros() const
+{
+  if (!_time_sync)
+    return std::nullopt;
+  return _time_sync->synchronized_micros(_micros_func());
+}
+
 void Node::spinSome()
 {
   processPortList();
+  processUpdatables();
   processRxQueue();
+  processDispatchQueue();
+  processTxStagingQueue();
   processTxQueue();
+  processTxCompletions();
+}
+
+void Node::processTxCompletions()
+{
+  /* Transfers sent via a transport other than CAN are complete as
+   * soon as they have been handed over. The callbacks are invoked
+   * from here as they may already enqueue the next transfer, those
+   * transfers complete during the next spinSome().
+   */
+  size_t num_transmitted = std::count_if(_tx_completion_items.cbegin(),
+                                         _tx_completion_items.cend(),
+                                         [](TxCompletionItem const & item) { return item.tx_timestamp_usec.has_value(); });
+  for (; num_transmitted > 0; num_transmitted--)
+  {
+    auto iter = std::find_if(_tx_completion_items.begin(),
+                             _tx_completion_items.end(),
+                             [](TxCompletionItem const & item) { return item.tx_timestamp_usec.has_value(); });
+    OnTransferTransmittedCb const on_transmitted_cb = std::move(iter->on_transmitted_cb);
+    CanardMicrosecond const tx_timestamp_usec = iter->tx_timestamp_usec.value();
+    _tx_completion_items.erase(iter);
+    on_transmitted_cb(tx_timestamp_usec);
+  }
+
+  /* Drop the completion notifications of transfers which
+   * have been discarded because their deadline passed or
+   * whose TX-done indication never reached the node.
+   */
+  CanardMicrosecond const now = _micros_func();
+  _tx_completion_items.erase(std::remove_if(_tx_completion_items.begin(),
+                                            _tx_completion_items.end(),
+                                            [now](TxCompletionItem const & item)
+                                            {
+                                              return now > (item.tx_deadline_usec + TX_COMPLETION_GRACE_PERIOD_usec);
+                                            }),
+                             _tx_completion_items.end());
 }
 
 void Node::processPortList()
@@ -108,48 +356,395 @@ void Node::processPortList()
     _opt_port_list_pub.value()->update();
 }
 
+void Node::addToPortList(CanardPortID const port_id, CanardTransferKind const transfer_kind, bool const is_publisher)
+{
+  if (!_opt_port_list_pub.has_value())
+    return;
+
+  if (transfer_kind == CanardTransferKindMessage)
+  {
+    if (is_publisher)
+      _opt_port_list_pub.value()->add_publisher(port_id);
+    else
+      _opt_port_list_pub.value()->add_subscriber(port_id);
+  }
+  else if (transfer_kind == CanardTransferKindRequest)
+    _opt_port_list_pub.value()->add_service_server(port_id);
+  else if (transfer_kind == CanardTransferKindResponse)
+    _opt_port_list_pub.value()->add_service_client(port_id);
+}
+
+
+void Node::processUpdatables()
+{
+  /* Iterate by index as an update may
+   * add or remove other updatables.
+   */
+  for (size_t i = 0; i < _updatables.size(); i++)
+    _updatables[i]->update();
+}
 
 void Node::onCanFrameReceived(CanardFrame const & frame)
 {
+  CanardMicrosecond const rx_timestamp_usec = _micros_func();
+
+  tapCanFrame(frame, rx_timestamp_usec, false);
+
   if (_mtu_bytes == CANARD_MTU_CAN_CLASSIC)
   {
-    CanRxQueueItem<CANARD_MTU_CAN_CLASSIC> const rx_queue_item(&frame, _micros_func());
+    CanRxQueueItem<CANARD_MTU_CAN_CLASSIC> const rx_queue_item(&frame, rx_timestamp_usec);
     static_cast<CircularBufferCan *>(_canard_rx_queue.get())->enqueue(rx_queue_item);
   }
   else if (_mtu_bytes == CANARD_MTU_CAN_FD)
   {
-    CanRxQueueItem<CANARD_MTU_CAN_FD> const rx_queue_item(&frame, _micros_func());
+    CanRxQueueItem<CANARD_MTU_CAN_FD> const rx_queue_item(&frame, rx_timestamp_usec);
     static_cast<CircularBufferCanFd *>(_canard_rx_queue.get())->enqueue(rx_queue_item);
   }
 }
 
+void Node::onCanFrameTransmitted(CanardFrame const & frame, CanardMicrosecond const tx_timestamp_usec)
+{
+  if (_tx_completion_items.empty() || (frame.payload_size == 0))
+    return;
+
+  /* Only the last frame of a transfer completes it. */
+  uint8_t const tail_byte = static_cast<uint8_t const *>(frame.payload)[frame.payload_size - 1];
+  if (!(tail_byte & TAIL_BYTE_END_OF_TRANSFER))
+    return;
+
+  uint32_t const can_id = frame.extended_can_id;
+  CanardTransferID const transfer_id = tail_byte & CANARD_TRANSFER_ID_MAX;
+
+  CanardTransferKind transfer_kind = CanardTransferKindMessage;
+  CanardPortID port_id = 0;
+  CanardNodeID remote_node_id = CANARD_NODE_ID_UNSET;
+
+  if (can_id & CAN_ID_FLAG_SERVICE_NOT_MESSAGE)
+  {
+    transfer_kind  = (can_id & CAN_ID_FLAG_REQUEST_NOT_RESPONSE) ? CanardTransferKindRequest : CanardTransferKindResponse;
+    port_id        = (can_id >> 14) & CANARD_SERVICE_ID_MAX;
+    remote_node_id = (can_id >> 7)  & CANARD_NODE_ID_MAX;
+  }
+  else
+    port_id = (can_id >> 8) & CANARD_SUBJECT_ID_MAX;
+
+  auto iter = std::find_if(_tx_completion_items.begin(),
+                           _tx_completion_items.end(),
+                           [&](TxCompletionItem const & item)
+                           {
+                             return (item.transfer_kind  == transfer_kind)  &&
+                                    (item.port_id        == port_id)        &&
+                                    (item.remote_node_id == remote_node_id) &&
+                                    (item.transfer_id    == transfer_id);
+                           });
+  if (iter == _tx_completion_items.end())
+    return;
+
+  /* Remove the item before invoking the callback so that
+   * the callback may already publish the next transfer.
+   */
+  OnTransferTransmittedCb const on_transmitted_cb = std::move(iter->on_transmitted_cb);
+  _tx_completion_items.erase(iter);
+  on_transmitted_cb(tx_timestamp_usec);
+}
+
 bool Node::enqueue_transfer(CanardMicrosecond const tx_timeout_usec,
                             CanardTransferMetadata const * const transfer_metadata,
                             size_t const payload_buf_size,
                             uint8_t const * const payload_buf)
 {
-  int32_t const rc = canardTxPush(&_canard_tx_queue,
-                                  &_canard_hdl,
-                                  _micros_func() + tx_timeout_usec,
-                                  transfer_metadata,
-                                  payload_buf_size,
-                                  payload_buf);
+  return enqueue_transfer(tx_timeout_usec, transfer_metadata, payload_buf_size, payload_buf, OnTransferTransmittedCb{});
+}
 
-  bool const success = (rc >= 0);
-  return success;
+bool Node::enqueue_transfer(CanardMicrosecond const tx_timeout_usec,
+                            CanardTransferMetadata const * const transfer_metadata,
+                            size_t const payload_buf_size,
+                            uint8_t const * const payload_buf,
+                            OnTransferTransmittedCb const & on_transmitted_cb)
+{
+  CanardMicrosecond const tx_deadline_usec = _micros_func() + tx_timeout_usec;
+
+  if (_tx_staging_queue)
+    return _tx_staging_queue->push(tx_deadline_usec, *transfer_metadata, payload_buf_size, payload_buf, on_transmitted_cb);
+
+  return pushTransfer(tx_deadline_usec, transfer_metadata, payload_buf_size, payload_buf, on_transmitted_cb);
 }
 
-void Node::unsubscribe(CanardPortID const port_id, CanardTransferKind const transfer_kind)
+void Node::unpublish(CanardPortID const port_id)
 {
-  canardRxUnsubscribe(&_canard_hdl,
-                      transfer_kind,
-                      port_id);
+  if (_opt_port_list_pub.has_value())
+    _opt_port_list_pub.value()->remove_publisher(port_id);
+}
+
+void Node::add_updatable(impl::UpdatableBase * updatable)
+{
+  _updatables.push_back(updatable);
+}
+
+void Node::remove_updatable(impl::UpdatableBase * updatable)
+{
+  _updatables.erase(std::remove(_updatables.begin(), _updatables.end(), updatable), _updatables.end());
+}
+
+void Node::register_time_sync(impl::TimeSyncBase * time_sync)
+{
+  _time_sync = time_sync;
+}
+
+void Node::unregister_time_sync(impl::TimeSyncBase * time_sync)
+{
+  if (_time_sync == time_sync)
+    _time_sync = nullptr;
+}
+
+/* A fixed number of slots is used as frames are tapped from
+ * within onCanFrameReceived(), which must neither allocate nor
+ * observe a container while it is being reallocated.
+ */
+bool Node::add_can_frame_tap(impl::CanFrameTapBase * can_frame_tap)
+{
+  auto slot = std::find(_can_frame_taps.begin(), _can_frame_taps.end(), nullptr);
+  if (slot == _can_frame_taps.end())
+    return false;
+
+  *slot = can_frame_tap;
+  return true;
+}
+
+void Node::remove_can_frame_tap(impl::CanFrameTapBase * can_frame_tap)
+{
+  std::replace(_can_frame_taps.begin(), _can_frame_taps.end(), can_frame_tap, static_cast<impl::CanFrameTapBase *>(nullptr));
+}
+
+bool Node::transmit_can_frame(CanardFrame const & frame)
+{
+  return _tx_func && _tx_func(frame);
+}
+
+void Node::unsubscribe(CanardPortID const port_id, CanardTransferKind const transfer_kind, impl::SubscriptionBase & sub)
+{
+  /* Pending transfers refer to the subscription being destroyed. */
+  if (_dispatch_queue)
+    _dispatch_queue->discard(sub);
+
+  /* A subject shared with other subscriptions remains subscribed. */
+  impl::SubscriptionBase * rx_sub = &sub;
+  impl::SubjectDispatcher * const dispatcher = (transfer_kind == CanardTransferKindMessage) ? findSubjectDispatcher(port_id) : nullptr;
+  if (dispatcher && dispatcher->remove(sub))
+    rx_sub = dispatcher->empty() ? static_cast<impl::SubscriptionBase *>(dispatcher) : nullptr;
+
+  /* A subscription which has been replaced (or was never subscribed)
+   * must not unsubscribe the port of the one replacing it.
+   */
+  if (rx_sub && (findRxSubscription(transfer_kind, port_id) == &rx_sub->canard_rx_subscription()))
+  {
+    int8_t const rc = canardRxUnsubscribe(&_canard_hdl,
+                                          transfer_kind,
+                                          port_id);
+
+    if ((rc > 0) && _transport)
+      _transport->unsubscribe(transfer_kind, port_id);
+
+    if (_dispatch_queue && (rx_sub != &sub))
+      _dispatch_queue->discard(*rx_sub);
+  }
+
+  /* A dispatcher is only destroyed outside of its own dispatch. */
+  _subject_dispatchers.erase(std::remove_if(_subject_dispatchers.begin(),
+                                            _subject_dispatchers.end(),
+                                            [](std::unique_ptr<impl::SubjectDispatcher> const & d) { return d->empty() && !d->is_dispatching(); }),
+                             _subject_dispatchers.end());
+
+  if (_opt_port_list_pub.has_value())
+  {
+    if (transfer_kind == CanardTransferKindMessage)
+      _opt_port_list_pub.value()->remove_subscriber(port_id);
+    else if (transfer_kind == CanardTransferKindRequest)
+      _opt_port_list_pub.value()->remove_service_server(port_id);
+    else if (transfer_kind == CanardTransferKindResponse)
+      _opt_port_list_pub.value()->remove_service_client(port_id);
+  }
 }
 
 /**************************************************************************************
  * PRIVATE MEMBER FUNCTIONS
  **************************************************************************************/
 
+template<size_t MTU_BYTES>
+void Node::processRxFrame(CanRxQueueItem<MTU_BYTES> const * const rx_queue_item)
+{
+  CanardFrame rx_frame;
+  rx_frame.extended_can_id = rx_queue_item->extended_can_id();
+  rx_frame.payload_size = rx_queue_item->payload_size();
+  rx_frame.payload = reinterpret_cast<const void *>(rx_queue_item->payload_buf().data());
+
+  CanardRxTransfer rx_transfer;
+  CanardRxSubscription * rx_subscription;
+  int8_t const result = canardRxAccept(&_canard_hdl,
+                                       rx_queue_item->rx_timestamp_usec(),
+                                       &rx_frame,
+                                       0, /* redundant_transport_index */
+                                       &rx_transfer,
+                                       &rx_subscription);
+
+  if(result == 1)
+  {
+    /* Obtain the pointer to the subscribed object and in invoke its reception callback. */
+    impl::SubscriptionBase * sub_ptr = static_cast<impl::SubscriptionBase *>(rx_subscription->user_reference);
+
+    /* The dispatch queue takes over the payload. */
+    if (_dispatch_queue)
+    {
+      _dispatch_queue->push(*sub_ptr, rx_transfer);
+      return;
+    }
+
+    sub_ptr->onTransferReceived(rx_transfer);
+
+    /* Free dynamically allocated memory after processing. */
+    _canard_hdl.memory_free(&_canard_hdl, rx_transfer.payload);
+  }
+}
+
+
+void Node::tapCanFrame(CanardFrame const & frame, CanardMicrosecond const timestamp_usec, bool const is_tx)
+{
+  for (auto can_frame_tap : _can_frame_taps)
+    if (can_frame_tap)
+      can_frame_tap->onCanFrame(frame, timestamp_usec, is_tx);
+}
+
+int8_t Node::subscribe(CanardTransferKind const transfer_kind,
+                       CanardPortID const port_id,
+                       size_t const extent,
+                       CanardMicrosecond const tid_timeout_usec,
+                       CanardRxSubscription * const rx_subscription)
+{
+  /* libcanard would replace the previous subscription of a subject,
+   * instead all of them are dispatched to.
+   */
+  if (transfer_kind == CanardTransferKindMessage)
+  {
+    CanardRxSubscription * const prev_rx_subscription = findRxSubscription(transfer_kind, port_id);
+    if (prev_rx_subscription && (prev_rx_subscription != rx_subscription))
+      return shareSubject(port_id, extent, tid_timeout_usec, *rx_subscription, *prev_rx_subscription);
+  }
+
+  int8_t const rc = canardRxSubscribe(&_canard_hdl,
+                                      transfer_kind,
+                                      port_id,
+                                      extent,
+                                      tid_timeout_usec,
+                                      rx_subscription);
+
+  /* Only newly subscribed ports are announced to the transport,
+   * a replaced subscription keeps receiving on the same port.
+   */
+  if ((rc > 0) && _transport && !_transport->subscribe(transfer_kind, port_id))
+  {
+    canardRxUnsubscribe(&_canard_hdl, transfer_kind, port_id);
+    return -CANARD_ERROR_INVALID_ARGUMENT;
+  }
+
+  return rc;
+}
+
+int8_t Node::shareSubject(CanardPortID const port_id,
+                          size_t const extent,
+                          CanardMicrosecond const tid_timeout_usec,
+                          CanardRxSubscription & rx_subscription,
+                          CanardRxSubscription & prev_rx_subscription)
+{
+  impl::SubjectDispatcher * dispatcher = findSubjectDispatcher(port_id);
+  if (!dispatcher)
+  {
+    _subject_dispatchers.push_back(std::make_unique<impl::SubjectDispatcher>(port_id));
+    dispatcher = _subject_dispatchers.back().get();
+  }
+
+  if (&prev_rx_subscription != &dispatcher->canard_rx_subscription())
+    dispatcher->add(*static_cast<impl::SubscriptionBase *>(prev_rx_subscription.user_reference), prev_rx_subscription.extent);
+  dispatcher->add(*static_cast<impl::SubscriptionBase *>(rx_subscription.user_reference), extent);
+
+  /* Replaces the previous subscription, hence
+   * the port remains subscribed at the transport.
+   */
+  return canardRxSubscribe(&_canard_hdl,
+                           CanardTransferKindMessage,
+                           port_id,
+                           dispatcher->extent(),
+                           tid_timeout_usec,
+                           &dispatcher->canard_rx_subscription());
+}
+
+CanardRxSubscription * Node::findRxSubscription(CanardTransferKind const transfer_kind, CanardPortID const port_id) const
+{
+  /* The subscriptions are kept in an AVL tree ordered by port-ID. */
+  CanardTreeNode * node = _canard_hdl.rx_subscriptions[transfer_kind];
+  while (node != nullptr)
+  {
+    CanardRxSubscription * sub = reinterpret_cast<CanardRxSubscription *>(node);
+    if (sub->port_id == port_id)
+      return sub;
+    node = node->lr[port_id > sub->port_id];
+  }
+  return nullptr;
+}
+
+impl::SubjectDispatcher * Node::findSubjectDispatcher(CanardPortID const port_id) const
+{
+  auto iter = std::find_if(_subject_dispatchers.cbegin(),
+                           _subject_dispatchers.cend(),
+                           [port_id](std::unique_ptr<impl::SubjectDispatcher> const & d) { return d->port_id() == port_id; });
+  return (iter != _subject_dispatchers.cend()) ? iter->get() : nullptr;
+}
+
+bool Node::pushTransfer(CanardMicrosecond const tx_deadline_usec,
+                        CanardTransferMetadata const * const transfer_metadata,
+                        size_t const payload_buf_size,
+                        uint8_t const * const payload_buf,
+                        OnTransferTransmittedCb const & on_transmitted_cb)
+{
+  /* Refuse the transfer rather than silently losing
+   * its completion notification.
+   */
+  if (on_transmitted_cb && (_tx_completion_items.size() >= MAX_PENDING_TX_COMPLETIONS))
+    return false;
+
+  bool success = false;
+  std::optional<CanardMicrosecond> tx_timestamp_usec = std::nullopt;
+
+  if (_transport)
+  {
+    success = _transport->transmit(*transfer_metadata, payload_buf_size, payload_buf);
+    tx_timestamp_usec = _micros_func();
+  }
+  else
+  {
+    int32_t const rc = canardTxPush(&_canard_tx_queue,
+                                    &_canard_hdl,
+                                    tx_deadline_usec,
+                                    transfer_metadata,
+                                    payload_buf_size,
+                                    payload_buf);
+    success = (rc >= 0);
+  }
+
+  if (success && on_transmitted_cb)
+  {
+    TxCompletionItem const item{transfer_metadata->transfer_kind,
+                                transfer_metadata->port_id,
+                                (transfer_metadata->transfer_kind == CanardTransferKindMessage) ? static_cast<CanardNodeID>(CANARD_NODE_ID_UNSET) : transfer_metadata->remote_node_id,
+                                static_cast<CanardTransferID>(transfer_metadata->transfer_id & CANARD_TRANSFER_ID_MAX),
+                                tx_deadline_usec,
+                                on_transmitted_cb,
+                                tx_timestamp_usec};
+    _tx_completion_items.push_back(item);
+  }
+
+  return success;
+}
+
 void * Node::o1heap_allocate(CanardInstance * const ins, size_t const amount)
 {
   O1HeapInstance * o1heap = reinterpret_cast<O1HeapInstance *>(ins->user_reference);
@@ -164,24 +759,62 @@ void Node::o1heap_free(CanardInstance * const ins, void * const pointer)
 
 void Node::processRxQueue()
 {
+  if (_transport)
+  {
+    _transport->processRx(_micros_func());
+    return;
+  }
+
+  /* With deferred dispatch all frames received so far are processed
+   * as reassembly is cheap, otherwise one frame per spinSome().
+   */
   if (_mtu_bytes == CANARD_MTU_CAN_CLASSIC)
   {
     CircularBufferCan * can_rx_queue_ptr = static_cast<CircularBufferCan *>(_canard_rx_queue.get());
-    CanRxQueueItem<CANARD_MTU_CAN_CLASSIC> const * rx_queue_item = can_rx_queue_ptr->peek();
-    if (!rx_queue_item) return;
-    processRxFrame(rx_queue_item);
-    can_rx_queue_ptr->pop();
+    for (size_t num_frames = _dispatch_queue ? can_rx_queue_ptr->size() : 1; num_frames > 0; num_frames--)
+    {
+      CanRxQueueItem<CANARD_MTU_CAN_CLASSIC> const * rx_queue_item = can_rx_queue_ptr->peek();
+      if (!rx_queue_item) return;
+      processRxFrame(rx_queue_item);
+      can_rx_queue_ptr->pop();
+    }
   }
   else if (_mtu_bytes == CANARD_MTU_CAN_FD)
   {
     CircularBufferCanFd * canfd_rx_queue_ptr = static_cast<CircularBufferCanFd *>(_canard_rx_queue.get());
-    CanRxQueueItem<CANARD_MTU_CAN_FD> const * rx_queue_item = canfd_rx_queue_ptr->peek();
-    if (!rx_queue_item) return;
-    processRxFrame(rx_queue_item);
-    canfd_rx_queue_ptr->pop();
+    for (size_t num_frames = _dispatch_queue ? canfd_rx_queue_ptr->size() : 1; num_frames > 0; num_frames--)
+    {
+      CanRxQueueItem<CANARD_MTU_CAN_FD> const * rx_queue_item = canfd_rx_queue_ptr->peek();
+      if (!rx_queue_item) return;
+      processRxFrame(rx_queue_item);
+      canfd_rx_queue_ptr->pop();
+    }
   }
 }
 
+void Node::processDispatchQueue()
+{
+  if (!_dispatch_queue)
+    return;
+
+  (void)_dispatch_queue->process(_micros_func, _dispatch_budget_usec);
+}
+
+void Node::processTxStagingQueue()
+{
+  if (!_tx_staging_queue)
+    return;
+
+  _tx_staging_queue->drain([this](impl::TxStagingQueue::Transfer const & transfer)
+                           {
+                             (void)pushTransfer(transfer.tx_deadline_usec,
+                                                &transfer.metadata,
+                                                transfer.payload_size,
+                                                transfer.payload,
+                                                transfer.on_transmitted_cb);
+                           });
+}
+
 void Node::processTxQueue()
 {
   for(CanardTxQueueItem * tx_queue_item = const_cast<CanardTxQueueItem *>(canardTxPeek(&_canard_tx_queue));
@@ -196,6 +829,7 @@ void Node::processTxQueue()
 
     /* Attempt to transmit the frame via CAN. */
     if (_tx_func(tx_queue_item->frame)) {
+      tapCanFrame(tx_queue_item->frame, _micros_func(), true);
       _canard_hdl.memory_free(&_canard_hdl, canardTxPop(&_canard_tx_queue, tx_queue_item));
       continue;
     }
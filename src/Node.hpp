@@ -18,6 +18,8 @@
 #include <array>
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 #include <functional>
 
 #include "PublisherBase.hpp"
@@ -25,14 +27,75 @@
 #include "CircularBuffer.hpp"
 #include "ServiceClientBase.hpp"
 #include "ServiceServerBase.hpp"
+#include "ConstResponseServiceServerBase.hpp"
+#include "UpdatableBase.hpp"
+#include "CanFrameTapBase.hpp"
 #include "CanRxQueueItem.hpp"
-#include "util/nodeinfo/NodeInfoBase.hpp"
-#include "util/registry/registry_impl.hpp"
-#include "util/port/PortListPublisherBase.hpp"
+#include "util/transfer_filter.hpp"
 
 #include "libo1heap/o1heap.h"
 #include "libcanard/canard.h"
 
+/**************************************************************************************
+ * FORWARD DECLARATION
+ **************************************************************************************/
+
+/* Only referred to by pointer, reference or shared_ptr handle, their
+ * headers are included by Node.cpp respectively 107-Arduino-Cyphal.h.
+ */
+namespace cyphal
+{
+
+namespace impl
+{
+class TransportBase;
+class TxStagingQueue;
+class DispatchQueue;
+class SubjectDispatcher;
+class ExecutorBase;
+class NodeInfoBase;
+class PnpClientBase;
+class PnpServerBase;
+class FileServerBase;
+class FileReadClientBase;
+class SoftwareUpdaterBase;
+class LoggerBase;
+class CanCaptureBase;
+class CanBridgeBase;
+class PortListPublisherBase;
+class TimeSyncBase;
+#if defined(__cpp_impl_coroutine)
+template <typename T_REQ, typename T_RSP> class AsyncServiceClientBase;
+template <typename T_REQ, typename T_RSP> class AsyncServiceClient;
+#endif
+} /* impl */
+
+#if !defined(__GNUC__) || (__GNUC__ >= 11)
+namespace registry { class Registry; }
+using Registry = std::shared_ptr<registry::Registry>;
+#endif
+
+using Executor          = std::shared_ptr<impl::ExecutorBase>;
+using NodeInfo          = std::shared_ptr<impl::NodeInfoBase>;
+using PnpClient         = std::shared_ptr<impl::PnpClientBase>;
+using PnpServer         = std::shared_ptr<impl::PnpServerBase>;
+using FileServer        = std::shared_ptr<impl::FileServerBase>;
+using FileReadClient    = std::shared_ptr<impl::FileReadClientBase>;
+using SoftwareUpdater   = std::shared_ptr<impl::SoftwareUpdaterBase>;
+using Logger            = std::shared_ptr<impl::LoggerBase>;
+using CanCapture        = std::shared_ptr<impl::CanCaptureBase>;
+using CanBridge         = std::shared_ptr<impl::CanBridgeBase>;
+using PortListPublisher = std::shared_ptr<impl::PortListPublisherBase>;
+using TimeSync          = std::shared_ptr<impl::TimeSyncBase>;
+
+namespace support::platform::storage::interface { class KeyValueStorage; }
+
+namespace support::platform::file::interface { class FileSource; class FileSink; }
+namespace support::platform::udp::interface { class UdpSocket; }
+namespace support::platform::serial::interface { class SerialPort; }
+
+} /* cyphal */
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -60,6 +123,19 @@ public:
   static size_t       constexpr DEFAULT_RX_QUEUE_SIZE = 64;
   static size_t       constexpr DEFAULT_TX_QUEUE_SIZE = 64;
   static size_t       constexpr DEFAULT_MTU_SIZE      = CANARD_MTU_CAN_CLASSIC;
+  static size_t       constexpr DEFAULT_UDP_MTU_SIZE  = 1408;
+  static size_t       constexpr DEFAULT_SERIAL_MTU_SIZE = 1024;
+  static size_t       constexpr MAX_PENDING_TX_COMPLETIONS = 8;
+  static size_t       constexpr MAX_CAN_FRAME_TAPS    = 4;
+  static size_t       constexpr DEFAULT_TX_STAGING_MAX_PAYLOAD_SIZE = 512;
+  /* The number of Read requests kept in flight by a file read client,
+   * the file server needs to be able to queue as many responses for
+   * transmission.
+   */
+  static size_t            constexpr DEFAULT_FILE_READ_WINDOW_SIZE        = 4;
+  static size_t            constexpr DEFAULT_MAX_CONCURRENT_UPDATES       = 2;
+  static CanardMicrosecond constexpr DEFAULT_UPDATE_START_INTERVAL_usec   = 5*1000*1000UL;
+  static uint16_t          constexpr DEFAULT_BRIDGE_MAX_FRAMES_PER_SECOND = 200;
 
 
   Node(uint8_t * heap_ptr,
@@ -77,31 +153,129 @@ public:
   Node(uint8_t * heap_ptr, size_t const heap_size, MicrosFunc const micros_func, CanFrameTxFunc const tx_func, CanardNodeID const node_id)
   : Node(heap_ptr, heap_size, micros_func, tx_func, node_id, DEFAULT_TX_QUEUE_SIZE, DEFAULT_RX_QUEUE_SIZE, DEFAULT_MTU_SIZE) { }
 
+  /* Operates the node via Cyphal/UDP instead of CAN, all
+   * publishers, subscriptions and services work unchanged.
+   * Transfers larger than mtu_bytes are split into multiple
+   * datagrams, the socket must outlive the node.
+   */
+  Node(uint8_t * heap_ptr,
+       size_t const heap_size,
+       MicrosFunc const micros_func,
+       support::platform::udp::interface::UdpSocket & udp_socket,
+       CanardNodeID const node_id = DEFAULT_NODE_ID,
+       size_t const mtu_bytes = DEFAULT_UDP_MTU_SIZE);
+
+  /* Operates the node via Cyphal/serial over a byte stream,
+   * e.g. a UART or USB-CDC. Frames received from nodes with
+   * a larger MTU are discarded, hence all nodes sharing the
+   * stream should use the same MTU. The serial port must
+   * outlive the node.
+   */
+  Node(uint8_t * heap_ptr,
+       size_t const heap_size,
+       MicrosFunc const micros_func,
+       support::platform::serial::interface::SerialPort & serial_port,
+       CanardNodeID const node_id = DEFAULT_NODE_ID,
+       size_t const mtu_bytes = DEFAULT_SERIAL_MTU_SIZE);
+
+  ~Node();
+
 
   inline void setNodeId(CanardNodeID const node_id) { _canard_hdl.node_id = node_id; }
   inline CanardNodeID getNodeId() const { return _canard_hdl.node_id; }
 
+  /* Makes publishing (and responding to requests) safe from any
+   * thread, e.g. from the callbacks run by an executor: transfers
+   * are then staged in a lock-free queue and handed over to the
+   * transport from within the next spinSome(). Publishers on
+   * different threads never block each other or spinSome(), but
+   * each publisher shall only be used by one thread at a time.
+   * Errors occurring after a transfer has been staged, e.g. a full
+   * transmit queue, are not reported. The micros function must be
+   * thread-safe. Must be called before any other thread uses the
+   * node. A buffer of max_payload_size bytes is reserved for each
+   * staged transfer, larger transfers are refused.
+   */
+  void enable_tx_staging(size_t const max_payload_size = DEFAULT_TX_STAGING_MAX_PAYLOAD_SIZE);
+
+  /* Defers the invocation of the subscription callbacks: completed
+   * transfers are held in a queue of the given capacity and
+   * dispatched from within spinSome() by transfer priority, until
+   * budget_usec have elapsed - but at least one transfer per
+   * spinSome(). All CAN frames received until spinSome() are
+   * reassembled at once so that slow callbacks no longer delay
+   * reception. Pending transfers keep their payload allocated from
+   * the node's heap. Once the queue is full transfers of a lower
+   * priority are dropped first, see dispatch_dropped().
+   */
+  void enable_deferred_dispatch(size_t const capacity, CanardMicrosecond const budget_usec);
+  [[nodiscard]] uint32_t dispatch_dropped() const;
+
 
   template <typename T>
   Publisher<T> create_publisher(CanardMicrosecond const tx_timeout_usec);
   template <typename T>
   Publisher<T> create_publisher(CanardPortID const port_id, CanardMicrosecond const tx_timeout_usec);
 
+  /* Callbacks taking T by value or by rvalue reference take over the
+   * deserialized message without copying it. T may also be a view (e.g.
+   * PortListView) which is passed instead of the message, see MessageView.
+   * Several subscriptions of the same subject (e.g. of the application
+   * and of the PnpServer to uavcan.node.Heartbeat) all receive each
+   * message.
+   */
   template <typename T, typename OnReceiveCb>
   Subscription create_subscription(OnReceiveCb&& on_receive_cb, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
   template <typename T, typename OnReceiveCb>
   Subscription create_subscription(CanardPortID const port_id, OnReceiveCb&& on_receive_cb, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+  /* The callback is invoked from the thread running the executor
+   * rather than from within spinSome(), see create_executor().
+   */
+  template <typename T, typename OnReceiveCb>
+  Subscription create_subscription(OnReceiveCb&& on_receive_cb, Executor executor, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+  template <typename T, typename OnReceiveCb>
+  Subscription create_subscription(CanardPortID const port_id, OnReceiveCb&& on_receive_cb, Executor executor, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+  /* Transfers rejected by the filter are dropped without being
+   * deserialized, e.g. TransferFilter().from(remote_node_id).
+   */
+  template <typename T, typename OnReceiveCb>
+  Subscription create_subscription(OnReceiveCb&& on_receive_cb, TransferFilter filter, Executor executor = nullptr, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+  template <typename T, typename OnReceiveCb>
+  Subscription create_subscription(CanardPortID const port_id, OnReceiveCb&& on_receive_cb, TransferFilter filter, Executor executor = nullptr, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
 
+  /* The request callback either returns the response, e.g. T_RSP(T_REQ const &),
+   * or fills in the response provided by the server, e.g. void(T_REQ const &, T_RSP &).
+   */
   template <typename T_REQ, typename T_RSP, typename OnRequestCb>
   ServiceServer create_service_server(CanardMicrosecond const tx_timeout_usec, OnRequestCb&& on_request_cb, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
   template <typename T_REQ, typename T_RSP, typename OnRequestCb>
   ServiceServer create_service_server(CanardPortID const request_port_id, CanardMicrosecond const tx_timeout_usec, OnRequestCb&& on_request_cb, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
 
+  /* Every request is answered with rsp, which is serialized once
+   * at creation and again only when updated, e.g. for GetInfo.
+   */
+  template <typename T_REQ, typename T_RSP>
+  ConstResponseServiceServer<T_RSP> create_const_response_service_server(CanardMicrosecond const tx_timeout_usec, T_RSP const & rsp, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+  template <typename T_REQ, typename T_RSP>
+  ConstResponseServiceServer<T_RSP> create_const_response_service_server(CanardPortID const request_port_id, CanardMicrosecond const tx_timeout_usec, T_RSP const & rsp, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+
   template <typename T_REQ, typename T_RSP, typename OnResponseCb>
   ServiceClient<T_REQ> create_service_client(CanardMicrosecond const tx_timeout_usec, OnResponseCb&& on_response_cb, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
   template <typename T_REQ, typename T_RSP, typename OnResponseCb>
   ServiceClient<T_REQ> create_service_client(CanardPortID const response_port_id, CanardMicrosecond const tx_timeout_usec, OnResponseCb&& on_response_cb, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
 
+#if defined(__cpp_impl_coroutine)
+  /* Creates a service client for C++20 coroutines, whose requests
+   * are awaited via co_await, see coro::Task. A response which does
+   * not arrive within response_timeout_usec yields std::nullopt.
+   * Needs util/coro/AsyncServiceClient.hpp (see 107-Arduino-Cyphal.h).
+   */
+  template <typename T_REQ, typename T_RSP>
+  std::shared_ptr<impl::AsyncServiceClientBase<T_REQ, T_RSP>> create_async_service_client(CanardMicrosecond const tx_timeout_usec, CanardMicrosecond const response_timeout_usec, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+  template <typename T_REQ, typename T_RSP>
+  std::shared_ptr<impl::AsyncServiceClientBase<T_REQ, T_RSP>> create_async_service_client(CanardPortID const port_id, CanardMicrosecond const tx_timeout_usec, CanardMicrosecond const response_timeout_usec, CanardMicrosecond const tid_timeout_usec = CANARD_DEFAULT_TRANSFER_ID_TIMEOUT_USEC);
+#endif
+
 #if !defined(__GNUC__) || (__GNUC__ >= 11)
   Registry create_registry();
 #endif
@@ -121,27 +295,161 @@ public:
                             std::string const & name,
                             uint64_t const image_crc);
 
+  /* Requests a node-ID from a plug-and-play node-ID allocator
+   * on the bus, using the same unique-ID as passed to
+   * create_node_info(). The node operates anonymously until
+   * a node-ID has been granted, which is then applied via
+   * setNodeId(). The allocation is carried out from within
+   * spinSome().
+   */
+  PnpClient create_pnp_client(std::array<uint8_t, 16> const & unique_id);
+
+#if !defined(__GNUC__) || (__GNUC__ >= 11)
+  /* Serves plug-and-play node-ID allocation requests on the
+   * bus. The allocation table is loaded from and persisted to
+   * the key-value storage. Must only be created after the
+   * allocators own node-ID has been configured.
+   */
+  PnpServer create_pnp_server(support::platform::storage::interface::KeyValueStorage & kv_storage);
+#endif
+
+  /* Periodically publishes uavcan.time.Synchronization, thereby
+   * making the local clock the network time base. Slaves can only
+   * synchronize if the driver reports the completed transmission
+   * of each frame via onCanFrameTransmitted(), otherwise the
+   * previous transmission timestamp is published as unknown.
+   */
+  TimeSync create_time_sync_master();
+  /* Synchronizes to the dominant time synchronization master
+   * on the bus, see synchronized_micros().
+   */
+  TimeSync create_time_sync_slave();
+
+  /* Serves uavcan.file.Read requests from the file source,
+   * e.g. to provide firmware images to nodes performing a
+   * software update. The file source must outlive the server.
+   */
+  FileServer create_file_server(support::platform::file::interface::FileSource & file_source);
+  /* Downloads a file from the file server via uavcan.file.Read,
+   * keeping a window of requests in flight and writing the file
+   * sequentially into the file sink from within spinSome(). Only
+   * one file read client may exist per node at any time.
+   */
+  FileReadClient create_file_read_client(CanardNodeID const server_node_id,
+                                         std::string const & path,
+                                         support::platform::file::interface::FileSink & file_sink,
+                                         size_t const window_size = DEFAULT_FILE_READ_WINDOW_SIZE);
+  /* Updates the software of the given nodes with the image
+   * provided by the file server at image_path. At most
+   * max_concurrent_updates nodes are updated at the same
+   * time and updates are started at least start_interval_usec
+   * apart in order to limit the load on the bus.
+   */
+  SoftwareUpdater create_software_updater(FileServer file_server,
+                                          std::string const & image_path,
+                                          std::vector<CanardNodeID> const & node_ids,
+                                          size_t const max_concurrent_updates = DEFAULT_MAX_CONCURRENT_UPDATES,
+                                          CanardMicrosecond const start_interval_usec = DEFAULT_UPDATE_START_INTERVAL_usec);
+
+  /* Publishes log records as uavcan.diagnostic.Record from within
+   * spinSome(), rate limited per severity. Logging itself is cheap
+   * and may be performed from any thread or interrupt context.
+   */
+  Logger create_logger();
+
+  /* Records all CAN frames received and transmitted by this node
+   * into a compact binary capture log written to the file sink,
+   * see CaptureReader and CaptureReplayer. At most
+   * MAX_CAN_FRAME_TAPS captures and bridges may exist per node.
+   */
+  CanCapture create_can_capture(support::platform::file::interface::FileSink & file_sink);
+  /* Forwards all CAN frames received and transmitted by bus_node
+   * as uavcan.metatransport.can.Frame.0.2 on tx_subject_id via this
+   * node, at the lowest priority and limited to max_frames_per_second.
+   * Frames received on rx_subject_id are transmitted by bus_node,
+   * allowing remote tools to observe and access the bridged bus.
+   * bus_node must be a different node than this one.
+   */
+  CanBridge create_can_bridge(Node & bus_node,
+                              CanardPortID const tx_subject_id,
+                              CanardPortID const rx_subject_id,
+                              uint16_t const max_frames_per_second = DEFAULT_BRIDGE_MAX_FRAMES_PER_SECOND);
+
+  /* Creates an executor for running subscription callbacks on
+   * a worker thread, which needs to call executor->spinSome()
+   * periodically. Each executor is served by a single thread,
+   * an executor may be shared by subscriptions of several nodes.
+   */
+  Executor create_executor();
+
+  /* Returns the current network time if a time synchronization
+   * master or a synchronized slave has been created.
+   */
+  std::optional<CanardMicrosecond> synchronized_micros() const;
+
   /* Must be called from the application to process
-   * all received CAN frames.
+   * all received CAN frames (or datagrams/bytes).
    */
   void spinSome();
   /* Must be called from the application upon the
    * reception of a can frame.
    */
   void onCanFrameReceived(CanardFrame const & frame);
+  /* May be called from the application upon a TX-done or
+   * loopback indication of the CAN driver for a frame sent
+   * by this node, the timestamp shall be as close as possible
+   * to the moment the frame was delivered to the bus.
+   */
+  void onCanFrameTransmitted(CanardFrame const & frame, CanardMicrosecond const tx_timestamp_usec);
 
 
   bool enqueue_transfer(CanardMicrosecond const tx_timeout_usec,
                         CanardTransferMetadata const * const transfer_metadata,
                         size_t const payload_buf_size,
                         uint8_t const * const payload_buf);
-  void unsubscribe(CanardPortID const port_id, CanardTransferKind const transfer_kind);
+  bool enqueue_transfer(CanardMicrosecond const tx_timeout_usec,
+                        CanardTransferMetadata const * const transfer_metadata,
+                        size_t const payload_buf_size,
+                        uint8_t const * const payload_buf,
+                        OnTransferTransmittedCb const & on_transmitted_cb);
+  void unpublish(CanardPortID const port_id);
+  void add_updatable(impl::UpdatableBase * updatable);
+  void remove_updatable(impl::UpdatableBase * updatable);
+  void register_time_sync(impl::TimeSyncBase * time_sync);
+  void unregister_time_sync(impl::TimeSyncBase * time_sync);
+  bool add_can_frame_tap(impl::CanFrameTapBase * can_frame_tap);
+  void remove_can_frame_tap(impl::CanFrameTapBase * can_frame_tap);
+  /* Transmits a raw CAN frame directly via the CAN driver,
+   * bypassing the transmit queue and the CAN frame taps.
+   */
+  bool transmit_can_frame(CanardFrame const & frame);
+  /* Subscriptions of the same subject share a single libcanard
+   * subscription, see impl::SubjectDispatcher. Only the removal of
+   * the last subscription of a port removes the port.
+   */
+  void unsubscribe(CanardPortID const port_id, CanardTransferKind const transfer_kind, impl::SubscriptionBase & sub);
 
 
 private:
   typedef CircularBuffer<CanRxQueueItem<CANARD_MTU_CAN_CLASSIC>> CircularBufferCan;
   typedef CircularBuffer<CanRxQueueItem<CANARD_MTU_CAN_FD>>      CircularBufferCanFd;
 
+  static CanardMicrosecond constexpr TX_COMPLETION_GRACE_PERIOD_usec = 1000*1000UL;
+  static uint32_t constexpr CAN_ID_FLAG_SERVICE_NOT_MESSAGE  = (1UL << 25);
+  static uint32_t constexpr CAN_ID_FLAG_REQUEST_NOT_RESPONSE = (1UL << 24);
+  static uint8_t  constexpr TAIL_BYTE_END_OF_TRANSFER        = (1U << 6);
+
+  struct TxCompletionItem
+  {
+    CanardTransferKind transfer_kind;
+    CanardPortID port_id;
+    CanardNodeID remote_node_id;
+    CanardTransferID transfer_id;
+    CanardMicrosecond tx_deadline_usec;
+    OnTransferTransmittedCb on_transmitted_cb;
+    std::optional<CanardMicrosecond> tx_timestamp_usec;
+  };
+
   O1HeapInstance * _o1heap_ins;
   CanardInstance _canard_hdl;
   MicrosFunc const _micros_func;
@@ -151,13 +459,49 @@ private:
   size_t const _mtu_bytes;
 
   std::optional<PortListPublisher> _opt_port_list_pub;
+  std::vector<impl::UpdatableBase *> _updatables;
+  impl::TimeSyncBase * _time_sync;
+  std::array<impl::CanFrameTapBase *, MAX_CAN_FRAME_TAPS> _can_frame_taps;
+  std::vector<TxCompletionItem> _tx_completion_items;
+  std::unique_ptr<impl::TransportBase> _transport;
+  std::unique_ptr<impl::TxStagingQueue> _tx_staging_queue;
+  std::unique_ptr<impl::DispatchQueue> _dispatch_queue;
+  CanardMicrosecond _dispatch_budget_usec;
+  std::vector<std::unique_ptr<impl::SubjectDispatcher>> _subject_dispatchers;
 
   static void * o1heap_allocate(CanardInstance * const ins, size_t const amount);
   static void   o1heap_free    (CanardInstance * const ins, void * const pointer);
 
+  int8_t subscribe(CanardTransferKind const transfer_kind,
+                   CanardPortID const port_id,
+                   size_t const extent,
+                   CanardMicrosecond const tid_timeout_usec,
+                   CanardRxSubscription * const rx_subscription);
+  int8_t shareSubject(CanardPortID const port_id,
+                      size_t const extent,
+                      CanardMicrosecond const tid_timeout_usec,
+                      CanardRxSubscription & rx_subscription,
+                      CanardRxSubscription & prev_rx_subscription);
+  [[nodiscard]] CanardRxSubscription * findRxSubscription(CanardTransferKind const transfer_kind, CanardPortID const port_id) const;
+  [[nodiscard]] impl::SubjectDispatcher * findSubjectDispatcher(CanardPortID const port_id) const;
+  bool pushTransfer(CanardMicrosecond const tx_deadline_usec,
+                    CanardTransferMetadata const * const transfer_metadata,
+                    size_t const payload_buf_size,
+                    uint8_t const * const payload_buf,
+                    OnTransferTransmittedCb const & on_transmitted_cb);
   void processRxQueue();
+  void processDispatchQueue();
+  void processTxStagingQueue();
   void processTxQueue();
+  void processTxCompletions();
   void processPortList();
+  /* Records a port created by this node in the published port list.
+   * Messages are recorded as published or subscribed, requests as
+   * served and responses as a service client.
+   */
+  void addToPortList(CanardPortID const port_id, CanardTransferKind const transfer_kind, bool const is_publisher);
+  void processUpdatables();
+  void tapCanFrame(CanardFrame const & frame, CanardMicrosecond const timestamp_usec, bool const is_tx);
   template<size_t MTU_BYTES>
   void processRxFrame(CanRxQueueItem<MTU_BYTES> const * const rx_queue_item);
 };
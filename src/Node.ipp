@@ -13,6 +13,7 @@
 #include "Subscription.hpp"
 #include "ServiceClient.hpp"
 #include "ServiceServer.hpp"
+#include "ConstResponseServiceServer.hpp"
 
 /**************************************************************************************
  * NAMESPACE
@@ -37,8 +38,7 @@ Publisher<T> Node::create_publisher(CanardPortID const port_id, CanardMicrosecon
 {
   static_assert(!T::_traits_::IsServiceType, "T is not message type");
 
-  if (_opt_port_list_pub.has_value())
-    _opt_port_list_pub.value()->add_publisher(port_id);
+  addToPortList(port_id, CanardTransferKindMessage, true);
 
   return std::make_shared<impl::Publisher<T>>(
     *this,
@@ -51,29 +51,55 @@ template <typename T, typename OnReceiveCb>
 Subscription Node::create_subscription(OnReceiveCb&& on_receive_cb, CanardMicrosecond const tid_timeout_usec)
 {
   static_assert(T::_traits_::HasFixedPortID, "T does not have a fixed port id.");
-  return create_subscription<T>(T::_traits_::FixedPortId, on_receive_cb, tid_timeout_usec);
+  return create_subscription<T>(T::_traits_::FixedPortId, std::forward<OnReceiveCb>(on_receive_cb), tid_timeout_usec);
 }
 
 template <typename T, typename OnReceiveCb>
 Subscription Node::create_subscription(CanardPortID const port_id, OnReceiveCb&& on_receive_cb, CanardMicrosecond const tid_timeout_usec)
+{
+  return create_subscription<T>(port_id, std::forward<OnReceiveCb>(on_receive_cb), Executor{}, tid_timeout_usec);
+}
+
+template <typename T, typename OnReceiveCb>
+Subscription Node::create_subscription(OnReceiveCb&& on_receive_cb, Executor executor, CanardMicrosecond const tid_timeout_usec)
+{
+  static_assert(T::_traits_::HasFixedPortID, "T does not have a fixed port id.");
+  return create_subscription<T>(T::_traits_::FixedPortId, std::forward<OnReceiveCb>(on_receive_cb), executor, tid_timeout_usec);
+}
+
+template <typename T, typename OnReceiveCb>
+Subscription Node::create_subscription(CanardPortID const port_id, OnReceiveCb&& on_receive_cb, Executor executor, CanardMicrosecond const tid_timeout_usec)
+{
+  return create_subscription<T>(port_id, std::forward<OnReceiveCb>(on_receive_cb), TransferFilter{}, executor, tid_timeout_usec);
+}
+
+template <typename T, typename OnReceiveCb>
+Subscription Node::create_subscription(OnReceiveCb&& on_receive_cb, TransferFilter filter, Executor executor, CanardMicrosecond const tid_timeout_usec)
+{
+  static_assert(T::_traits_::HasFixedPortID, "T does not have a fixed port id.");
+  return create_subscription<T>(T::_traits_::FixedPortId, std::forward<OnReceiveCb>(on_receive_cb), std::move(filter), executor, tid_timeout_usec);
+}
+
+template <typename T, typename OnReceiveCb>
+Subscription Node::create_subscription(CanardPortID const port_id, OnReceiveCb&& on_receive_cb, TransferFilter filter, Executor executor, CanardMicrosecond const tid_timeout_usec)
 {
   static_assert(!T::_traits_::IsServiceType, "T is not message type");
 
-  if (_opt_port_list_pub.has_value())
-    _opt_port_list_pub.value()->add_subscriber(port_id);
+  addToPortList(port_id, CanardTransferKindMessage, false);
 
-  auto sub = std::make_shared<impl::Subscription<T, OnReceiveCb>>(
+  auto sub = std::make_shared<impl::Subscription<T, std::decay_t<OnReceiveCb>>>(
     *this,
     port_id,
-    std::forward<OnReceiveCb>(on_receive_cb)
+    std::forward<OnReceiveCb>(on_receive_cb),
+    executor,
+    std::move(filter)
     );
 
-  int8_t const rc = canardRxSubscribe(&_canard_hdl,
-                                      CanardTransferKindMessage,
-                                      port_id,
-                                      T::_traits_::ExtentBytes,
-                                      tid_timeout_usec,
-                                      &(sub->canard_rx_subscription()));
+  int8_t const rc = subscribe(CanardTransferKindMessage,
+                              port_id,
+                              T::_traits_::ExtentBytes,
+                              tid_timeout_usec,
+                              &(sub->canard_rx_subscription()));
   if (rc < 0)
     return nullptr;
 
@@ -86,7 +112,7 @@ ServiceServer Node::create_service_server(CanardMicrosecond const tx_timeout_use
   static_assert(T_REQ::_traits_::HasFixedPortID, "T_REQ does not have a fixed port id.");
   static_assert(T_RSP::_traits_::HasFixedPortID, "T_RSP does not have a fixed port id.");
 
-  return create_service_server<T_REQ, T_RSP>(T_REQ::_traits_::FixedPortId, tx_timeout_usec, on_request_cb, tid_timeout_usec);
+  return create_service_server<T_REQ, T_RSP>(T_REQ::_traits_::FixedPortId, tx_timeout_usec, std::forward<OnRequestCb>(on_request_cb), tid_timeout_usec);
 }
 
 template <typename T_REQ, typename T_RSP, typename OnRequestCb>
@@ -95,25 +121,60 @@ ServiceServer Node::create_service_server(CanardPortID const request_port_id, Ca
   static_assert(T_REQ::_traits_::IsRequest, "T_REQ is not a request");
   static_assert(T_RSP::_traits_::IsResponse, "T_RSP is not a response");
 
-  if (_opt_port_list_pub.has_value())
-    _opt_port_list_pub.value()->add_service_server(request_port_id);
+  addToPortList(request_port_id, CanardTransferKindRequest, false);
 
-  auto srv = std::make_shared<impl::ServiceServer<T_REQ, T_RSP, OnRequestCb>>(
+  auto srv = std::make_shared<impl::ServiceServer<T_REQ, T_RSP, std::decay_t<OnRequestCb>>>(
     *this,
     request_port_id,
     tx_timeout_usec,
     std::forward<OnRequestCb>(on_request_cb)
     );
 
-  int8_t const rc = canardRxSubscribe(&_canard_hdl,
-                                      CanardTransferKindRequest,
-                                      request_port_id,
-                                      T_REQ::_traits_::ExtentBytes,
-                                      tid_timeout_usec,
-                                      &(srv->canard_rx_subscription()));
+  int8_t const rc = subscribe(CanardTransferKindRequest,
+                              request_port_id,
+                              T_REQ::_traits_::ExtentBytes,
+                              tid_timeout_usec,
+                              &(srv->canard_rx_subscription()));
+  if (rc < 0)
+    return nullptr;
+
+  return srv;
+}
+
+template <typename T_REQ, typename T_RSP>
+ConstResponseServiceServer<T_RSP> Node::create_const_response_service_server(CanardMicrosecond const tx_timeout_usec, T_RSP const & rsp, CanardMicrosecond const tid_timeout_usec)
+{
+  static_assert(T_REQ::_traits_::HasFixedPortID, "T_REQ does not have a fixed port id.");
+  static_assert(T_RSP::_traits_::HasFixedPortID, "T_RSP does not have a fixed port id.");
+
+  return create_const_response_service_server<T_REQ, T_RSP>(T_REQ::_traits_::FixedPortId, tx_timeout_usec, rsp, tid_timeout_usec);
+}
+
+template <typename T_REQ, typename T_RSP>
+ConstResponseServiceServer<T_RSP> Node::create_const_response_service_server(CanardPortID const request_port_id, CanardMicrosecond const tx_timeout_usec, T_RSP const & rsp, CanardMicrosecond const tid_timeout_usec)
+{
+  static_assert(T_REQ::_traits_::IsRequest, "T_REQ is not a request");
+  static_assert(T_RSP::_traits_::IsResponse, "T_RSP is not a response");
+
+  addToPortList(request_port_id, CanardTransferKindRequest, false);
+
+  auto srv = std::make_shared<impl::ConstResponseServiceServer<T_REQ, T_RSP>>(
+    *this,
+    request_port_id,
+    tx_timeout_usec
+    );
+
+  int8_t const rc = subscribe(CanardTransferKindRequest,
+                              request_port_id,
+                              T_REQ::_traits_::ExtentBytes,
+                              tid_timeout_usec,
+                              &(srv->canard_rx_subscription()));
   if (rc < 0)
     return nullptr;
 
+  if (!srv->update(rsp))
+    return nullptr;
+
   return srv;
 }
 
@@ -123,7 +184,7 @@ ServiceClient<T_REQ> Node::create_service_client(CanardMicrosecond const tx_time
   static_assert(T_REQ::_traits_::HasFixedPortID, "T_REQ does not have a fixed port id.");
   static_assert(T_RSP::_traits_::HasFixedPortID, "T_RSP does not have a fixed port id.");
 
-  return create_service_client<T_REQ, T_RSP>(T_RSP::_traits_::FixedPortId, tx_timeout_usec, on_response_cb, tid_timeout_usec);
+  return create_service_client<T_REQ, T_RSP>(T_RSP::_traits_::FixedPortId, tx_timeout_usec, std::forward<OnResponseCb>(on_response_cb), tid_timeout_usec);
 }
 
 template <typename T_REQ, typename T_RSP, typename OnResponseCb>
@@ -132,55 +193,55 @@ ServiceClient<T_REQ> Node::create_service_client(CanardPortID const response_por
   static_assert(T_REQ::_traits_::IsRequest, "T_REQ is not a request");
   static_assert(T_RSP::_traits_::IsResponse, "T_RSP is not a response");
 
-  if (_opt_port_list_pub.has_value())
-    _opt_port_list_pub.value()->add_service_client(response_port_id);
+  addToPortList(response_port_id, CanardTransferKindResponse, false);
 
-  auto clt = std::make_shared<impl::ServiceClient<T_REQ, T_RSP, OnResponseCb>>(
+  auto clt = std::make_shared<impl::ServiceClient<T_REQ, T_RSP, std::decay_t<OnResponseCb>>>(
     *this,
     response_port_id,
     tx_timeout_usec,
     std::forward<OnResponseCb>(on_response_cb)
   );
 
-  int8_t const rc = canardRxSubscribe(&_canard_hdl,
-                                      CanardTransferKindResponse,
-                                      response_port_id,
-                                      T_RSP::_traits_::ExtentBytes,
-                                      tid_timeout_usec,
-                                      &(clt->canard_rx_subscription()));
+  int8_t const rc = subscribe(CanardTransferKindResponse,
+                              response_port_id,
+                              T_RSP::_traits_::ExtentBytes,
+                              tid_timeout_usec,
+                              &(clt->canard_rx_subscription()));
   if (rc < 0)
     return nullptr;
 
   return clt;
 }
 
-template<size_t MTU_BYTES>
-void Node::processRxFrame(CanRxQueueItem<MTU_BYTES> const * const rx_queue_item)
+#if defined(__cpp_impl_coroutine)
+template <typename T_REQ, typename T_RSP>
+std::shared_ptr<impl::AsyncServiceClientBase<T_REQ, T_RSP>> Node::create_async_service_client(CanardMicrosecond const tx_timeout_usec, CanardMicrosecond const response_timeout_usec, CanardMicrosecond const tid_timeout_usec)
 {
-  CanardFrame rx_frame;
-  rx_frame.extended_can_id = rx_queue_item->extended_can_id();
-  rx_frame.payload_size = rx_queue_item->payload_size();
-  rx_frame.payload = reinterpret_cast<const void *>(rx_queue_item->payload_buf().data());
+  static_assert(T_RSP::_traits_::HasFixedPortID, "T_RSP does not have a fixed port id.");
+  return create_async_service_client<T_REQ, T_RSP>(T_RSP::_traits_::FixedPortId, tx_timeout_usec, response_timeout_usec, tid_timeout_usec);
+}
 
-  CanardRxTransfer rx_transfer;
-  CanardRxSubscription * rx_subscription;
-  int8_t const result = canardRxAccept(&_canard_hdl,
-                                       rx_queue_item->rx_timestamp_usec(),
-                                       &rx_frame,
-                                       0, /* redundant_transport_index */
-                                       &rx_transfer,
-                                       &rx_subscription);
+template <typename T_REQ, typename T_RSP>
+std::shared_ptr<impl::AsyncServiceClientBase<T_REQ, T_RSP>> Node::create_async_service_client(CanardPortID const port_id, CanardMicrosecond const tx_timeout_usec, CanardMicrosecond const response_timeout_usec, CanardMicrosecond const tid_timeout_usec)
+{
+  static_assert(T_REQ::_traits_::IsRequest, "T_REQ is not a request");
+  static_assert(T_RSP::_traits_::IsResponse, "T_RSP is not a response");
+
+  addToPortList(port_id, CanardTransferKindResponse, false);
+
+  auto clt = std::make_shared<impl::AsyncServiceClient<T_REQ, T_RSP>>(*this, _micros_func, port_id, tx_timeout_usec, response_timeout_usec);
 
-  if(result == 1)
-  {
-    /* Obtain the pointer to the subscribed object and in invoke its reception callback. */
-    impl::SubscriptionBase * sub_ptr = static_cast<impl::SubscriptionBase *>(rx_subscription->user_reference);
-    sub_ptr->onTransferReceived(rx_transfer);
+  int8_t const rc = subscribe(CanardTransferKindResponse,
+                              port_id,
+                              T_RSP::_traits_::ExtentBytes,
+                              tid_timeout_usec,
+                              &(clt->canard_rx_subscription()));
+  if (rc < 0)
+    return nullptr;
 
-    /* Free dynamically allocated memory after processing. */
-    _canard_hdl.memory_free(&_canard_hdl, rx_transfer.payload);
-  }
+  return clt;
 }
+#endif
 
 /**************************************************************************************
  * NAMESPACE
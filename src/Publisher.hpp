@@ -39,9 +39,10 @@ public:
   , _tx_timeout_usec{tx_timeout_usec}
   , _transfer_id{0}
   { }
-  virtual ~Publisher() { }
+  virtual ~Publisher();
 
   bool publish(T const & msg) override;
+  bool publish(T const & msg, OnTransferTransmittedCb const & on_transmitted_cb) override;
 
 private:
   Node & _node_hdl;
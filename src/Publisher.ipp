@@ -25,12 +25,28 @@ namespace cyphal
 namespace impl
 {
 
+/**************************************************************************************
+ * CTOR/DTOR
+ **************************************************************************************/
+
+template<typename T>
+Publisher<T>::~Publisher()
+{
+  _node_hdl.unpublish(_port_id);
+}
+
 /**************************************************************************************
  * PUBLIC MEMBER FUNCTIONS
  **************************************************************************************/
 
 template<typename T>
 bool Publisher<T>::publish(T const & msg)
+{
+  return publish(msg, OnTransferTransmittedCb{});
+}
+
+template<typename T>
+bool Publisher<T>::publish(T const & msg, OnTransferTransmittedCb const & on_transmitted_cb)
 {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wpedantic"
@@ -54,7 +70,8 @@ bool Publisher<T>::publish(T const & msg)
   return _node_hdl.enqueue_transfer(_tx_timeout_usec,
                                     &transfer_metadata,
                                     *rc,
-                                    msg_buf.data());
+                                    msg_buf.data(),
+                                    on_transmitted_cb);
 }
 
 /**************************************************************************************
@@ -12,6 +12,9 @@
  **************************************************************************************/
 
 #include <memory>
+#include <functional>
+
+#include "libcanard/canard.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -20,6 +23,12 @@
 namespace cyphal
 {
 
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+typedef std::function<void(CanardMicrosecond const tx_timestamp_usec)> OnTransferTransmittedCb;
+
 namespace impl
 {
 
@@ -39,6 +48,11 @@ public:
   PublisherBase &operator=(PublisherBase &&) = delete;
 
   virtual bool publish(T const & msg) = 0;
+  /* The callback is invoked with the transmission timestamp once the
+   * driver reports the last frame of the transfer as transmitted via
+   * Node::onCanFrameTransmitted().
+   */
+  virtual bool publish(T const & msg, OnTransferTransmittedCb const & on_transmitted_cb) = 0;
 };
 
 /**************************************************************************************
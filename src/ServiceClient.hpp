@@ -13,6 +13,8 @@
 
 #include "ServiceClientBase.hpp"
 
+#include "util/view/MessageView.hpp"
+
 #include "Node.hpp"
 
 /**************************************************************************************
@@ -53,6 +55,8 @@ private:
   CanardMicrosecond const _tx_timeout_usec;
   OnResponseCb _on_response_cb;
   CanardTransferID _transfer_id;
+
+  void invoke(T_RSP && rsp, CanardRxTransfer const & transfer);
 };
 
 /**************************************************************************************
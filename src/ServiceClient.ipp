@@ -31,7 +31,7 @@ namespace impl {
 template<typename T_REQ, typename T_RSP, typename OnResponseCb>
 ServiceClient<T_REQ, T_RSP, OnResponseCb>::~ServiceClient()
 {
-  _node_hdl.unsubscribe(_response_port_id, SubscriptionBase::canard_transfer_kind());
+  _node_hdl.unsubscribe(_response_port_id, SubscriptionBase::canard_transfer_kind(), *this);
 }
 
 /**************************************************************************************
@@ -69,18 +69,47 @@ bool ServiceClient<T_REQ, T_RSP, OnResponseCb>::request(CanardNodeID const remot
 template<typename T_REQ, typename T_RSP, typename OnResponseCb>
 bool ServiceClient<T_REQ, T_RSP, OnResponseCb>::onTransferReceived(CanardRxTransfer const & transfer)
 {
-  /* Deserialize the response message. */
-  T_RSP rsp;
-  nunavut::support::const_bitspan rsp_bitspan(static_cast<uint8_t *>(transfer.payload), transfer.payload_size);
-  auto const rc = deserialize(rsp, rsp_bitspan);
-  if (!rc) return false;
-
-  /* Invoke the user registered callback. */
-  _on_response_cb(rsp);
+  if constexpr (is_message_view_v<T_RSP>)
+  {
+    /* Views decode their fields lazily from the payload. */
+    invoke(T_RSP(static_cast<uint8_t const *>(transfer.payload), transfer.payload_size), transfer);
+  }
+  else
+  {
+    /* Deserialize the response message. */
+    T_RSP rsp;
+    nunavut::support::const_bitspan rsp_bitspan(static_cast<uint8_t *>(transfer.payload), transfer.payload_size);
+    auto const rc = deserialize(rsp, rsp_bitspan);
+    if (!rc) return false;
+
+    invoke(std::move(rsp), transfer);
+  }
 
   return true;
 }
 
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+template<typename T_REQ, typename T_RSP, typename OnResponseCb>
+void ServiceClient<T_REQ, T_RSP, OnResponseCb>::invoke(T_RSP && rsp, CanardRxTransfer const & transfer)
+{
+  /* Invoke the user registered callback, callbacks taking the
+   * response by value or by rvalue reference take it over without
+   * copying it.
+   */
+  if constexpr (std::is_invocable_v<OnResponseCb, T_RSP &&, TransferMetadata>) {
+    _on_response_cb(std::move(rsp), SubscriptionBase::fillMetadata(transfer));
+  } else if constexpr (std::is_invocable_v<OnResponseCb, T_RSP &, TransferMetadata>) {
+    _on_response_cb(rsp, SubscriptionBase::fillMetadata(transfer));
+  } else if constexpr (std::is_invocable_v<OnResponseCb, T_RSP &&>) {
+    _on_response_cb(std::move(rsp));
+  } else {
+    _on_response_cb(rsp);
+  }
+}
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -50,6 +50,8 @@ private:
   CanardPortID const _request_port_id;
   CanardMicrosecond const _tx_timeout_usec;
   OnRequestCb _on_request_cb;
+
+  bool respond(T_RSP const & rsp, CanardRxTransfer const & transfer);
 };
 
 /**************************************************************************************
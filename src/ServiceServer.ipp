@@ -30,7 +30,7 @@ namespace impl
 template<typename T_REQ, typename T_RSP, typename OnRequestCb>
 ServiceServer<T_REQ, T_RSP, OnRequestCb>::~ServiceServer()
 {
-  _node_hdl.unsubscribe(_request_port_id, SubscriptionBase::canard_transfer_kind());
+  _node_hdl.unsubscribe(_request_port_id, SubscriptionBase::canard_transfer_kind(), *this);
 }
 
 /**************************************************************************************
@@ -46,14 +46,32 @@ bool ServiceServer<T_REQ, T_RSP, OnRequestCb>::onTransferReceived(CanardRxTransf
   auto const req_rc = deserialize(req, req_buf_bitspan);
   if (!req_rc) return false;
 
-  /* Invoke the service callback and obtain the desired response. */
-  T_RSP rsp;
-  if constexpr (std::is_invocable_v<OnRequestCb, T_REQ, TransferMetadata>) {
-    rsp = _on_request_cb(req, fillMetadata(transfer));
+  /* Invoke the service callback and obtain the desired response,
+   * callbacks may either return the response or fill in the one
+   * provided by the server.
+   */
+  if constexpr (std::is_invocable_v<OnRequestCb, T_REQ, T_RSP &, TransferMetadata>) {
+    T_RSP rsp{};
+    _on_request_cb(req, rsp, fillMetadata(transfer));
+    return respond(rsp, transfer);
+  } else if constexpr (std::is_invocable_v<OnRequestCb, T_REQ, T_RSP &>) {
+    T_RSP rsp{};
+    _on_request_cb(req, rsp);
+    return respond(rsp, transfer);
+  } else if constexpr (std::is_invocable_v<OnRequestCb, T_REQ, TransferMetadata>) {
+    return respond(_on_request_cb(req, fillMetadata(transfer)), transfer);
   } else {
-    rsp = _on_request_cb(req);
+    return respond(_on_request_cb(req), transfer);
   }
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
 
+template<typename T_REQ, typename T_RSP, typename OnRequestCb>
+bool ServiceServer<T_REQ, T_RSP, OnRequestCb>::respond(T_RSP const & rsp, CanardRxTransfer const & transfer)
+{
   /* Serialize the response message. */
   std::array<uint8_t, T_RSP::_traits_::SerializationBufferSizeBytes> rsp_buf;
   nunavut::support::bitspan rsp_buf_bitspan{rsp_buf};
@@ -13,6 +13,10 @@
 
 #include "SubscriptionBase.h"
 
+#include "util/transfer_filter.hpp"
+#include "util/view/MessageView.hpp"
+#include "util/executor/ExecutorBase.hpp"
+
 #include "Node.hpp"
 
 /**************************************************************************************
@@ -33,22 +37,30 @@ template <typename T, typename OnReceiveCb>
 class Subscription final : public SubscriptionBase
 {
 public:
-  Subscription(Node & node_hdl, CanardPortID const port_id, OnReceiveCb const & on_receive_cb)
+  Subscription(Node & node_hdl, CanardPortID const port_id, OnReceiveCb const & on_receive_cb, Executor executor = nullptr, TransferFilter filter = TransferFilter{})
   : SubscriptionBase{CanardTransferKindMessage}
   , _node_hdl{node_hdl}
   , _port_id{port_id}
   , _on_receive_cb{on_receive_cb}
+  , _executor{executor}
+  , _filter{std::move(filter)}
   { }
   virtual ~Subscription();
 
 
   bool onTransferReceived(CanardRxTransfer const & transfer) override;
+  bool onTransferExecuted(CanardRxTransfer const & transfer) override;
 
 
 private:
   Node & _node_hdl;
   CanardPortID const _port_id;
   OnReceiveCb _on_receive_cb;
+  Executor _executor;
+  TransferFilter const _filter;
+
+  bool deliver(CanardRxTransfer const & transfer);
+  void invoke(T && msg, CanardRxTransfer const & transfer);
 };
 
 /**************************************************************************************
@@ -30,7 +30,10 @@ namespace impl
 template<typename T, typename OnReceiveCb>
 Subscription<T, OnReceiveCb>::~Subscription()
 {
-  _node_hdl.unsubscribe(_port_id, SubscriptionBase::canard_transfer_kind());
+  _node_hdl.unsubscribe(_port_id, SubscriptionBase::canard_transfer_kind(), *this);
+
+  if (_executor)
+    _executor->cancel(*this);
 }
 
 /**************************************************************************************
@@ -40,21 +43,64 @@ Subscription<T, OnReceiveCb>::~Subscription()
 template<typename T, typename OnReceiveCb>
 bool Subscription<T, OnReceiveCb>::onTransferReceived(CanardRxTransfer const & transfer)
 {
-  T msg;
-  nunavut::support::const_bitspan msg_bitspan(static_cast<uint8_t *>(transfer.payload), transfer.payload_size);
-  auto const rc = deserialize(msg, msg_bitspan);
-  if (!rc) return false;
+  /* Filtered before being deserialized or handed to the executor. */
+  if (!_filter.accepts(transfer))
+    return false;
 
-  if constexpr (std::is_invocable_v<OnReceiveCb, T, TransferMetadata>) {
-    _on_receive_cb(msg, fillMetadata(transfer));
-  } else {
-    _on_receive_cb(msg);
+  if (_executor)
+    return _executor->post(*this, transfer);
+
+  return deliver(transfer);
+}
+
+template<typename T, typename OnReceiveCb>
+bool Subscription<T, OnReceiveCb>::onTransferExecuted(CanardRxTransfer const & transfer)
+{
+  return deliver(transfer);
+}
+
+/**************************************************************************************
+ * PRIVATE MEMBER FUNCTIONS
+ **************************************************************************************/
+
+template<typename T, typename OnReceiveCb>
+bool Subscription<T, OnReceiveCb>::deliver(CanardRxTransfer const & transfer)
+{
+  if constexpr (is_message_view_v<T>)
+  {
+    /* Views decode their fields lazily from the payload. */
+    invoke(T(static_cast<uint8_t const *>(transfer.payload), transfer.payload_size), transfer);
   }
+  else
+  {
+    T msg;
+    nunavut::support::const_bitspan msg_bitspan(static_cast<uint8_t *>(transfer.payload), transfer.payload_size);
+    auto const rc = deserialize(msg, msg_bitspan);
+    if (!rc) return false;
 
+    invoke(std::move(msg), transfer);
+  }
 
   return true;
 }
 
+template<typename T, typename OnReceiveCb>
+void Subscription<T, OnReceiveCb>::invoke(T && msg, CanardRxTransfer const & transfer)
+{
+  /* Callbacks taking the message by value or by rvalue reference
+   * take it over without copying it.
+   */
+  if constexpr (std::is_invocable_v<OnReceiveCb, T &&, TransferMetadata>) {
+    _on_receive_cb(std::move(msg), fillMetadata(transfer));
+  } else if constexpr (std::is_invocable_v<OnReceiveCb, T &, TransferMetadata>) {
+    _on_receive_cb(msg, fillMetadata(transfer));
+  } else if constexpr (std::is_invocable_v<OnReceiveCb, T &&>) {
+    _on_receive_cb(std::move(msg));
+  } else {
+    _on_receive_cb(msg);
+  }
+}
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
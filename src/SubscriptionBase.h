@@ -46,6 +46,10 @@ public:
 
 
   virtual bool onTransferReceived(CanardRxTransfer const & transfer) = 0;
+  /* Invoked from the worker thread of the executor the subscription
+   * is bound to for each transfer it has posted to the executor.
+   */
+  virtual bool onTransferExecuted(CanardRxTransfer const & /* transfer */) { return false; }
 
 
   [[nodiscard]] CanardRxSubscription &canard_rx_subscription() { return _canard_rx_sub; }
@@ -59,6 +63,8 @@ protected:
   {
     TransferMetadata transfer_metadata;
     transfer_metadata.remote_node_id = static_cast<uint16_t>(transfer.metadata.remote_node_id);
+    transfer_metadata.transfer_id = transfer.metadata.transfer_id;
+    transfer_metadata.timestamp_usec = transfer.timestamp_usec;
 
     return transfer_metadata;
   }
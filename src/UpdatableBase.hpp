@@ -0,0 +1,46 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Base class for all components which need to perform
+ * periodic work from within Node::spinSome(), i.e. any
+ * kind of timer driven state machine.
+ */
+class UpdatableBase
+{
+public:
+  UpdatableBase() = default;
+  virtual ~UpdatableBase() { }
+  UpdatableBase(UpdatableBase const &) = delete;
+  UpdatableBase(UpdatableBase &&) = delete;
+  UpdatableBase &operator=(UpdatableBase const &) = delete;
+  UpdatableBase &operator=(UpdatableBase &&) = delete;
+
+  virtual void update() = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
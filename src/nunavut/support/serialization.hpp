@@ -11,8 +11,8 @@
 //     enable_override_variable_array_capacity:  False
 //     std:  c++17
 //     cast_format:  static_cast<{type}>({value})
-//     variable_array_type_include:  <vector>
-//     variable_array_type_template:  std::vector<{TYPE}>
+//     variable_array_type_include:  <util/array/VariableLengthArray.hpp>
+//     variable_array_type_template:  cyphal::support::VariableLengthArray<{TYPE}, {MAX_SIZE}>
 //     variable_array_type_constructor_args:
 //     allocator_include:
 //     allocator_type:
@@ -191,8 +191,8 @@ constexpr std::uint32_t enable_serialization_asserts = 0;
 constexpr std::uint32_t enable_override_variable_array_capacity = 0;
 constexpr std::uint32_t std = 628873475;
 constexpr std::uint32_t cast_format = 1407868567;
-constexpr std::uint32_t variable_array_type_include = 3320664631;
-constexpr std::uint32_t variable_array_type_template = 4227611599;
+constexpr std::uint32_t variable_array_type_include = 2304536898;
+constexpr std::uint32_t variable_array_type_template = 4056808703;
 constexpr std::uint32_t variable_array_type_constructor_args = 0;
 constexpr std::uint32_t allocator_include = 0;
 constexpr std::uint32_t allocator_type = 0;
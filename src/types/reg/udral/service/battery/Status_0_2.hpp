@@ -35,8 +35,8 @@
 //     enable_override_variable_array_capacity:  False
 //     std:  c++17
 //     cast_format:  static_cast<{type}>({value})
-//     variable_array_type_include:  <vector>
-//     variable_array_type_template:  std::vector<{TYPE}>
+//     variable_array_type_include:  <util/array/VariableLengthArray.hpp>
+//     variable_array_type_template:  cyphal::support::VariableLengthArray<{TYPE}, {MAX_SIZE}>
 //     variable_array_type_constructor_args:
 //     allocator_include:
 //     allocator_type:
@@ -55,7 +55,7 @@
 #include <array>
 #include <cstdint>
 #include <limits>
-#include <vector>
+#include <util/array/VariableLengthArray.hpp>
 
 namespace reg
 {
@@ -101,12 +101,12 @@ static_assert( nunavut::support::options::cast_format == 1407868567,
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
               "allowed." );
-static_assert( nunavut::support::options::variable_array_type_include == 3320664631,
+static_assert( nunavut::support::options::variable_array_type_include == 2304536898,
               "/tmp/public_regulated_data_types/reg/udral/service/battery/Status.0.2.dsdl "
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
               "allowed." );
-static_assert( nunavut::support::options::variable_array_type_template == 4227611599,
+static_assert( nunavut::support::options::variable_array_type_template == 4056808703,
               "/tmp/public_regulated_data_types/reg/udral/service/battery/Status.0.2.dsdl "
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
@@ -175,7 +175,7 @@ struct Status_0_2 final
             using temperature_min_max = std::array<uavcan::si::unit::temperature::Scalar_1_0,2>;
             using available_charge = uavcan::si::unit::electric_charge::Scalar_1_0;
             using _error = reg::udral::service::battery::Error_0_1;
-            using cell_voltages = std::vector<float>;
+            using cell_voltages = cyphal::support::VariableLengthArray<float, 255>;
         };
     };
 
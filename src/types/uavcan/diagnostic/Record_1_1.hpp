@@ -35,8 +35,8 @@
 //     enable_override_variable_array_capacity:  False
 //     std:  c++17
 //     cast_format:  static_cast<{type}>({value})
-//     variable_array_type_include:  <vector>
-//     variable_array_type_template:  std::vector<{TYPE}>
+//     variable_array_type_include:  <util/array/VariableLengthArray.hpp>
+//     variable_array_type_template:  cyphal::support::VariableLengthArray<{TYPE}, {MAX_SIZE}>
 //     variable_array_type_constructor_args:
 //     allocator_include:
 //     allocator_type:
@@ -52,7 +52,7 @@
 #include <types/uavcan/time/SynchronizedTimestamp_1_0.hpp>
 #include <cstdint>
 #include <limits>
-#include <vector>
+#include <util/array/VariableLengthArray.hpp>
 
 namespace uavcan
 {
@@ -94,12 +94,12 @@ static_assert( nunavut::support::options::cast_format == 1407868567,
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
               "allowed." );
-static_assert( nunavut::support::options::variable_array_type_include == 3320664631,
+static_assert( nunavut::support::options::variable_array_type_include == 2304536898,
               "/tmp/public_regulated_data_types/uavcan/diagnostic/8184.Record.1.1.dsdl "
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
               "allowed." );
-static_assert( nunavut::support::options::variable_array_type_template == 4227611599,
+static_assert( nunavut::support::options::variable_array_type_template == 4056808703,
               "/tmp/public_regulated_data_types/uavcan/diagnostic/8184.Record.1.1.dsdl "
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
@@ -166,7 +166,7 @@ struct Record_1_1 final
             TypeOf() = delete;
             using timestamp = uavcan::time::SynchronizedTimestamp_1_0;
             using severity = uavcan::diagnostic::Severity_1_0;
-            using text = std::vector<std::uint8_t>;
+            using text = cyphal::support::VariableLengthArray<std::uint8_t, 255>;
         };
     };
 
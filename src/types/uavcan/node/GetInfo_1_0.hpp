@@ -35,8 +35,8 @@
 //     enable_override_variable_array_capacity:  False
 //     std:  c++17
 //     cast_format:  static_cast<{type}>({value})
-//     variable_array_type_include:  <vector>
-//     variable_array_type_template:  std::vector<{TYPE}>
+//     variable_array_type_include:  <util/array/VariableLengthArray.hpp>
+//     variable_array_type_template:  cyphal::support::VariableLengthArray<{TYPE}, {MAX_SIZE}>
 //     variable_array_type_constructor_args:
 //     allocator_include:
 //     allocator_type:
@@ -52,7 +52,7 @@
 #include <array>
 #include <cstdint>
 #include <limits>
-#include <vector>
+#include <util/array/VariableLengthArray.hpp>
 
 namespace uavcan
 {
@@ -94,12 +94,12 @@ static_assert( nunavut::support::options::cast_format == 1407868567,
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
               "allowed." );
-static_assert( nunavut::support::options::variable_array_type_include == 3320664631,
+static_assert( nunavut::support::options::variable_array_type_include == 2304536898,
               "/tmp/public_regulated_data_types/uavcan/node/430.GetInfo.1.0.dsdl "
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
               "allowed." );
-static_assert( nunavut::support::options::variable_array_type_template == 4227611599,
+static_assert( nunavut::support::options::variable_array_type_template == 4056808703,
               "/tmp/public_regulated_data_types/uavcan/node/430.GetInfo.1.0.dsdl "
               "is trying to use a serialization library that was compiled with "
               "different language options. This is dangerous and therefore not "
@@ -225,9 +225,9 @@ struct Response_1_0 final
             using software_version = uavcan::node::Version_1_0;
             using software_vcs_revision_id = std::uint64_t;
             using unique_id = std::array<std::uint8_t,16>;
-            using name = std::vector<std::uint8_t>;
-            using software_image_crc = std::vector<std::uint64_t>;
-            using certificate_of_authenticity = std::vector<std::uint8_t>;
+            using name = cyphal::support::VariableLengthArray<std::uint8_t, 50>;
+            using software_image_crc = cyphal::support::VariableLengthArray<std::uint64_t, 1>;
+            using certificate_of_authenticity = cyphal::support::VariableLengthArray<std::uint8_t, 222>;
         };
     };
 
@@ -0,0 +1,93 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "../../libo1heap/o1heap.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Heap for the elements of variable-length arrays exceeding their
+ * inline storage, see SmallVariableLengthArray. Once an arena has
+ * been assigned via init(), e.g. a Node::Heap, the elements are
+ * allocated from it in constant time, otherwise via std::malloc().
+ * Like o1heap itself the arena is not thread-safe: messages whose
+ * arrays exceed their inline storage must then only be handled by
+ * a single thread.
+ */
+class ArrayHeap
+{
+public:
+  ArrayHeap() = delete;
+
+
+  /* Shall be called at most once. Returns false if the arena
+   * is too small or not aligned at O1HEAP_ALIGNMENT.
+   */
+  static bool init(uint8_t * const base, size_t const size)
+  {
+    _state.instance = o1heapInit(base, size);
+    if (!_state.instance)
+      return false;
+
+    _state.base = base;
+    _state.size = size;
+    return true;
+  }
+
+  [[nodiscard]] static void * allocate(size_t const amount)
+  {
+    if (_state.instance)
+      return o1heapAllocate(_state.instance, amount);
+    return std::malloc(amount);
+  }
+
+  /* Memory allocated before init() has been called is still
+   * returned to std::free().
+   */
+  static void free(void * const pointer)
+  {
+    uint8_t const * const ptr = static_cast<uint8_t const *>(pointer);
+    if (_state.instance && (ptr >= _state.base) && (ptr < (_state.base + _state.size)))
+      o1heapFree(_state.instance, pointer);
+    else
+      std::free(pointer);
+  }
+
+
+private:
+  struct State
+  {
+    O1HeapInstance * instance;
+    uint8_t const * base;
+    size_t size;
+  };
+
+  static inline State _state{nullptr, nullptr, 0};
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support */
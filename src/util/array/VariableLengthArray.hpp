@@ -0,0 +1,344 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <new>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+
+#include "ArrayHeap.hpp"
+
+/**************************************************************************************
+ * DEFINES
+ **************************************************************************************/
+
+#ifndef CYPHAL_SMALL_BUFFER_INLINE_BYTES
+# define CYPHAL_SMALL_BUFFER_INLINE_BYTES 64
+#endif
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::support
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Variable-length array of up to MAX_SIZE elements, the first
+ * INLINE_SIZE of which are stored inline. Larger arrays are moved
+ * into a buffer obtained from the Allocator, which is sized exactly
+ * if the required size is reserved upfront - as done by the
+ * generated deserialization code. Provides the subset of the
+ * std::vector interface used by the generated DSDL types. As the
+ * generated code checks the DSDL bound before inserting, elements
+ * exceeding MAX_SIZE - or the allocator's memory - are silently
+ * discarded.
+ */
+template <typename T, size_t MAX_SIZE, size_t INLINE_SIZE, typename Allocator = ArrayHeap>
+class SmallVariableLengthArray
+{
+  static_assert(INLINE_SIZE <= MAX_SIZE, "INLINE_SIZE must not exceed MAX_SIZE");
+
+public:
+  typedef T value_type;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T & reference;
+  typedef T const & const_reference;
+  typedef T * pointer;
+  typedef T const * const_pointer;
+  typedef T * iterator;
+  typedef T const * const_iterator;
+
+
+  SmallVariableLengthArray() noexcept
+  : _heap_data{nullptr}
+  , _heap_capacity{0}
+  , _size{0}
+  { }
+  SmallVariableLengthArray(size_type const count, T const & value)
+  : SmallVariableLengthArray()
+  {
+    assign(count, value);
+  }
+  template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  SmallVariableLengthArray(InputIt first, InputIt last)
+  : SmallVariableLengthArray()
+  {
+    assign(first, last);
+  }
+  SmallVariableLengthArray(std::initializer_list<T> list)
+  : SmallVariableLengthArray()
+  {
+    assign(list.begin(), list.end());
+  }
+  SmallVariableLengthArray(SmallVariableLengthArray const & other)
+  : SmallVariableLengthArray()
+  {
+    assign(other.cbegin(), other.cend());
+  }
+  SmallVariableLengthArray(SmallVariableLengthArray && other) noexcept(std::is_nothrow_move_constructible_v<T>)
+  : SmallVariableLengthArray()
+  {
+    take(std::move(other));
+  }
+  ~SmallVariableLengthArray()
+  {
+    clear();
+    release();
+  }
+  SmallVariableLengthArray & operator=(SmallVariableLengthArray const & other)
+  {
+    if (this != &other)
+      assign(other.cbegin(), other.cend());
+    return *this;
+  }
+  SmallVariableLengthArray & operator=(SmallVariableLengthArray && other) noexcept(std::is_nothrow_move_constructible_v<T>)
+  {
+    if (this != &other)
+    {
+      clear();
+      release();
+      take(std::move(other));
+    }
+    return *this;
+  }
+  SmallVariableLengthArray & operator=(std::initializer_list<T> list)
+  {
+    assign(list.begin(), list.end());
+    return *this;
+  }
+
+
+  [[nodiscard]] size_type size() const noexcept { return _size; }
+  [[nodiscard]] bool empty() const noexcept { return _size == 0; }
+  [[nodiscard]] size_type capacity() const noexcept { return _heap_data ? _heap_capacity : INLINE_SIZE; }
+  [[nodiscard]] static constexpr size_type max_size() noexcept { return MAX_SIZE; }
+  [[nodiscard]] bool is_inline() const noexcept { return _heap_data == nullptr; }
+
+  T * data() noexcept { return _heap_data ? _heap_data : std::launder(reinterpret_cast<T *>(_storage)); }
+  T const * data() const noexcept { return _heap_data ? _heap_data : std::launder(reinterpret_cast<T const *>(_storage)); }
+
+  T & operator[](size_type const pos) noexcept { return data()[pos]; }
+  T const & operator[](size_type const pos) const noexcept { return data()[pos]; }
+  T & front() noexcept { return data()[0]; }
+  T const & front() const noexcept { return data()[0]; }
+  T & back() noexcept { return data()[_size - 1]; }
+  T const & back() const noexcept { return data()[_size - 1]; }
+
+  iterator begin() noexcept { return data(); }
+  iterator end() noexcept { return data() + _size; }
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end() const noexcept { return data() + _size; }
+  const_iterator cbegin() const noexcept { return data(); }
+  const_iterator cend() const noexcept { return data() + _size; }
+
+
+  /* Returns false if the memory could not be allocated. */
+  bool reserve(size_type const new_capacity)
+  {
+    size_type const capacity_required = std::min(new_capacity, MAX_SIZE);
+    if (capacity_required <= capacity())
+      return true;
+
+    if constexpr (INLINE_SIZE < MAX_SIZE)
+    {
+      T * const new_data = static_cast<T *>(Allocator::allocate(capacity_required * sizeof(T)));
+      if (!new_data)
+        return false;
+
+      T * const old_data = data();
+      for (size_type i = 0; i < _size; i++)
+      {
+        new (new_data + i) T(std::move(old_data[i]));
+        old_data[i].~T();
+      }
+      release();
+
+      _heap_data     = new_data;
+      _heap_capacity = capacity_required;
+    }
+    return true;
+  }
+
+  void clear() noexcept
+  {
+    if constexpr (!std::is_trivially_destructible_v<T>)
+      for (size_type i = 0; i < _size; i++)
+        data()[i].~T();
+    _size = 0;
+  }
+
+  void push_back(T const & value) { emplace_back(value); }
+  void push_back(T && value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  void emplace_back(Args &&... args)
+  {
+    if (_size == capacity())
+      reserve(std::max<size_type>(2 * _size, 1));
+    if (_size == capacity())
+      return;
+    new (data() + _size) T(std::forward<Args>(args)...);
+    _size++;
+  }
+
+  void pop_back() noexcept
+  {
+    if (_size == 0)
+      return;
+    _size--;
+    data()[_size].~T();
+  }
+
+  void resize(size_type const count) { resize(count, T()); }
+  void resize(size_type const count, T const & value)
+  {
+    while (_size > count)
+      pop_back();
+    reserve(count);
+    while ((_size < count) && (_size < capacity()))
+      emplace_back(value);
+  }
+
+  void assign(size_type const count, T const & value)
+  {
+    clear();
+    resize(count, value);
+  }
+  template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  void assign(InputIt first, InputIt last)
+  {
+    clear();
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+      reserve(static_cast<size_type>(std::distance(first, last)));
+    for (; (first != last) && (_size < MAX_SIZE); ++first)
+      emplace_back(*first);
+  }
+  void assign(std::initializer_list<T> list)
+  {
+    assign(list.begin(), list.end());
+  }
+
+
+private:
+  alignas(T) unsigned char _storage[sizeof(T) * std::max<size_t>(INLINE_SIZE, 1)];
+  T * _heap_data;
+  size_type _heap_capacity;
+  size_type _size;
+
+
+  /* Expects this array to be empty and without heap buffer. */
+  void take(SmallVariableLengthArray && other)
+  {
+    if (other._heap_data)
+    {
+      _heap_data           = other._heap_data;
+      _heap_capacity       = other._heap_capacity;
+      _size                = other._size;
+      other._heap_data     = nullptr;
+      other._heap_capacity = 0;
+      other._size          = 0;
+      return;
+    }
+
+    for (auto & elem : other)
+      emplace_back(std::move(elem));
+    other.clear();
+  }
+
+  void release() noexcept
+  {
+    if constexpr (INLINE_SIZE < MAX_SIZE)
+      if (_heap_data)
+        Allocator::free(_heap_data);
+    _heap_data     = nullptr;
+    _heap_capacity = 0;
+  }
+};
+
+/**************************************************************************************
+ * FREE FUNCTION DEFINITION
+ **************************************************************************************/
+
+template <typename T, size_t MAX_SIZE, size_t INLINE_SIZE, typename Allocator>
+bool operator==(SmallVariableLengthArray<T, MAX_SIZE, INLINE_SIZE, Allocator> const & lhs, SmallVariableLengthArray<T, MAX_SIZE, INLINE_SIZE, Allocator> const & rhs)
+{
+  return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+template <typename T, size_t MAX_SIZE, size_t INLINE_SIZE, typename Allocator>
+bool operator!=(SmallVariableLengthArray<T, MAX_SIZE, INLINE_SIZE, Allocator> const & lhs, SmallVariableLengthArray<T, MAX_SIZE, INLINE_SIZE, Allocator> const & rhs)
+{
+  return !(lhs == rhs);
+}
+
+/* The number of elements of a variable-length field of the generated
+ * types stored inline: the complete field if it does not exceed
+ * CYPHAL_SMALL_BUFFER_INLINE_BYTES, otherwise as many elements as fit
+ * into it - but at least one.
+ */
+template <typename T, size_t MAX_SIZE>
+constexpr size_t smallBufferInlineSize()
+{
+  return std::min(MAX_SIZE, std::max<size_t>(CYPHAL_SMALL_BUFFER_INLINE_BYTES / sizeof(T), 1));
+}
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* Never allocates as all elements are stored inline. */
+template <typename T, size_t MAX_SIZE>
+using InlineVariableLengthArray = SmallVariableLengthArray<T, MAX_SIZE, MAX_SIZE>;
+
+/* The array type of all variable-length fields of the generated DSDL
+ * types, configured for all translation units, e.g. via the CMake
+ * options of the same name:
+ *
+ * CYPHAL_HEAP_FREE_TYPES:    Stores them inline, making the types
+ *                            allocation-free at the cost of their size
+ *                            being determined by the DSDL bounds.
+ * CYPHAL_SMALL_BUFFER_TYPES: Stores up to CYPHAL_SMALL_BUFFER_INLINE_BYTES
+ *                            per field inline and larger ones on the
+ *                            ArrayHeap.
+ *
+ * Otherwise they are std::vectors.
+ */
+#if defined(CYPHAL_HEAP_FREE_TYPES) && defined(CYPHAL_SMALL_BUFFER_TYPES)
+# error "CYPHAL_HEAP_FREE_TYPES and CYPHAL_SMALL_BUFFER_TYPES are mutually exclusive"
+#elif defined(CYPHAL_HEAP_FREE_TYPES)
+template <typename T, size_t MAX_SIZE>
+using VariableLengthArray = InlineVariableLengthArray<T, MAX_SIZE>;
+#elif defined(CYPHAL_SMALL_BUFFER_TYPES)
+template <typename T, size_t MAX_SIZE>
+using VariableLengthArray = SmallVariableLengthArray<T, MAX_SIZE, smallBufferInlineSize<T, MAX_SIZE>()>;
+#else
+template <typename T, size_t /* MAX_SIZE */>
+using VariableLengthArray = std::vector<T>;
+#endif
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::support */
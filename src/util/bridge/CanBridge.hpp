@@ -0,0 +1,151 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "CanBridgeBase.hpp"
+
+#include <array>
+
+#include "../rate/TokenBucket.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/metatransport/can.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class CanBridge final : public CanBridgeBase
+{
+public:
+  typedef uavcan::metatransport::can::Frame_0_2 TFrame;
+
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec       = 1000*1000UL;
+  /* Bounds the time spent in a single spinSome(). */
+  static size_t            constexpr MAX_FRAMES_PER_UPDATE = 16;
+
+
+  CanBridge(Node & node_hdl,
+            cyphal::Node::MicrosFunc const micros_func,
+            Node & bus_node_hdl,
+            CanardPortID const tx_subject_id,
+            CanardPortID const rx_subject_id,
+            uint16_t const max_frames_per_second)
+  : _node_hdl{node_hdl}
+  , _micros_func{micros_func}
+  , _bus_node_hdl{bus_node_hdl}
+  , _tx_subject_id{tx_subject_id}
+  , _rx_subject_id{rx_subject_id}
+  , _rate_limit{}
+  , _frame_buf{}
+  , _transfer_id{0}
+  {
+    /* Bursts of up to a full queue are forwarded. */
+    _rate_limit.configure(max_frames_per_second, QUEUE_CAPACITY, _micros_func());
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~CanBridge()
+  {
+    _bus_node_hdl.remove_can_frame_tap(this);
+    _node_hdl.remove_updatable(this);
+    _node_hdl.unpublish(_tx_subject_id);
+    _node_hdl.unsubscribe(_rx_subject_id, SubscriptionBase::canard_transfer_kind(), *this);
+  }
+
+
+  /* Metatransport frames are forwarded in batches of up to
+   * MAX_FRAMES_PER_UPDATE, each serialized straight into the
+   * transfer buffer. Frame.0.2 carries a single CAN frame,
+   * hence one transfer is required per frame.
+   */
+  virtual void update() override
+  {
+    auto const now = _micros_func();
+
+    for (size_t n = 0; n < MAX_FRAMES_PER_UPDATE; n++)
+    {
+      auto const entry = _queue.pop();
+      if (!entry.has_value())
+        return;
+
+      if (!_rate_limit.consume(now) || !publish(entry.value()))
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    auto const frame = MetatransportCanCodec::decodeFrame(static_cast<uint8_t const *>(transfer.payload), transfer.payload_size);
+    if (!frame.has_value())
+      return false;
+
+    CanardFrame const can_frame{frame->extended_can_id, frame->data_length, frame->data};
+    return _bus_node_hdl.transmit_can_frame(can_frame);
+  }
+
+
+private:
+  Node & _node_hdl;
+  cyphal::Node::MicrosFunc const _micros_func;
+  Node & _bus_node_hdl;
+  CanardPortID const _tx_subject_id;
+  CanardPortID const _rx_subject_id;
+  TokenBucket _rate_limit;
+  std::array<uint8_t, MetatransportCanCodec::MAX_FRAME_SIZE> _frame_buf;
+  CanardTransferID _transfer_id;
+
+
+  /* Bridged frames are published at the lowest priority,
+   * so they never delay the regular traffic of this node.
+   */
+  bool publish(Entry const & entry)
+  {
+    auto const frame_size = MetatransportCanCodec::encodeFrame(_frame_buf.data(), entry.extended_can_id, entry.data.data(), entry.data_length);
+    if (!frame_size.has_value())
+      return false;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    CanardTransferMetadata const transfer_metadata =
+    {
+      .priority       = CanardPriorityOptional,
+      .transfer_kind  = CanardTransferKindMessage,
+      .port_id        = _tx_subject_id,
+      .remote_node_id = CANARD_NODE_ID_UNSET,
+      .transfer_id    = _transfer_id++,
+    };
+#pragma GCC diagnostic pop
+
+    return _node_hdl.enqueue_transfer(TX_TIMEOUT_usec,
+                                      &transfer_metadata,
+                                      frame_size.value(),
+                                      _frame_buf.data());
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
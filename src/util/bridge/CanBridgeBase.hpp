@@ -0,0 +1,109 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+#include "MetatransportCanCodec.hpp"
+#include "../queue/MpscQueue.hpp"
+#include "../../SubscriptionBase.h"
+#include "../../UpdatableBase.hpp"
+#include "../../CanFrameTapBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Frames of the bridged bus are tapped into a lock-free queue and
+ * forwarded as uavcan.metatransport.can.Frame.0.2 from within
+ * Node::spinSome(). Received metatransport frames are transmitted
+ * on the bridged bus right away.
+ */
+class CanBridgeBase : public SubscriptionBase, public CanFrameTapBase, public UpdatableBase
+{
+public:
+  static size_t constexpr QUEUE_CAPACITY = 32;
+
+
+  CanBridgeBase()
+  : SubscriptionBase{CanardTransferKindMessage}
+  , _queue{}
+  , _dropped{0}
+  { }
+  virtual ~CanBridgeBase() { }
+
+
+  virtual void onCanFrame(CanardFrame const & frame, CanardMicrosecond const /* timestamp_usec */, bool const /* is_tx */) override
+  {
+    Entry entry;
+    entry.extended_can_id = frame.extended_can_id;
+    entry.data_length     = static_cast<uint8_t>(std::min(frame.payload_size, entry.data.size()));
+    std::copy_n(static_cast<uint8_t const *>(frame.payload), entry.data_length, entry.data.begin());
+
+    if (!_queue.push(entry))
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /* The number of frames of the bridged bus which were not
+   * forwarded, either because the queue was full, the rate limit
+   * was exceeded or the transfer could not be enqueued.
+   */
+  [[nodiscard]] uint32_t dropped() const
+  {
+    return _dropped.load(std::memory_order_relaxed);
+  }
+
+
+protected:
+  struct Entry
+  {
+    uint32_t extended_can_id;
+    uint8_t data_length;
+    std::array<uint8_t, MetatransportCanCodec::MAX_FD_DATA_LENGTH> data;
+  };
+
+  MpscQueue<Entry, QUEUE_CAPACITY> _queue;
+  std::atomic<uint32_t> _dropped;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using CanBridge = std::shared_ptr<impl::CanBridgeBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
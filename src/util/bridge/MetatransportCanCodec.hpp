@@ -0,0 +1,117 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Encodes and decodes uavcan.metatransport.can.Frame.0.2 carrying
+ * data frames with an extended (29 bit) CAN-ID directly from/into
+ * transfer buffers, avoiding the heap allocated data arrays of the
+ * generated types. All involved types are sealed:
+ *
+ * Frame:         uint8 tag (1 = data_fd, 2 = data_classic) | DataFD/DataClassic
+ * DataFD:        ArbitrationID | uint8 length | uint8[<=64] data
+ * DataClassic:   ArbitrationID | uint8 length | uint8[<=8]  data
+ * ArbitrationID: uint8 tag (1 = extended) | uint29 id | void3
+ */
+class MetatransportCanCodec
+{
+public:
+  static uint8_t  constexpr TAG_DATA_FD             = 1;
+  static uint8_t  constexpr TAG_DATA_CLASSIC        = 2;
+  static uint8_t  constexpr TAG_EXTENDED_ID         = 1;
+  static size_t   constexpr HEADER_SIZE             = 7;
+  static size_t   constexpr MAX_CLASSIC_DATA_LENGTH = 8;
+  static size_t   constexpr MAX_FD_DATA_LENGTH      = 64;
+  static size_t   constexpr MAX_FRAME_SIZE          = HEADER_SIZE + MAX_FD_DATA_LENGTH;
+  static uint32_t constexpr EXTENDED_ID_MASK        = 0x1FFFFFFFUL;
+
+  struct Frame
+  {
+    uint32_t extended_can_id;
+    uint8_t const * data;
+    size_t data_length;
+  };
+
+
+  /* Frames with up to 8 data bytes are encoded as classic frames.
+   * Returns the number of bytes of the encoded frame, buf must be
+   * at least MAX_FRAME_SIZE bytes large.
+   */
+  [[nodiscard]] static std::optional<size_t> encodeFrame(uint8_t * const buf, uint32_t const extended_can_id, uint8_t const * const data, size_t const data_length)
+  {
+    if (data_length > MAX_FD_DATA_LENGTH)
+      return std::nullopt;
+
+    uint32_t const id = extended_can_id & EXTENDED_ID_MASK;
+
+    buf[0] = (data_length > MAX_CLASSIC_DATA_LENGTH) ? TAG_DATA_FD : TAG_DATA_CLASSIC;
+    buf[1] = TAG_EXTENDED_ID;
+    for (size_t i = 0; i < 4; i++)
+      buf[2 + i] = static_cast<uint8_t>(id >> (8 * i));
+    buf[6] = static_cast<uint8_t>(data_length);
+    std::memcpy(buf + HEADER_SIZE, data, data_length);
+
+    return HEADER_SIZE + data_length;
+  }
+
+  /* Error frames, remote frames and frames with a base (11 bit)
+   * CAN-ID are not decoded. The returned data refers to the memory
+   * of buf.
+   */
+  [[nodiscard]] static std::optional<Frame> decodeFrame(uint8_t const * const buf, size_t const size)
+  {
+    if (size < HEADER_SIZE)
+      return std::nullopt;
+
+    size_t max_data_length = 0;
+    if (buf[0] == TAG_DATA_FD)
+      max_data_length = MAX_FD_DATA_LENGTH;
+    else if (buf[0] == TAG_DATA_CLASSIC)
+      max_data_length = MAX_CLASSIC_DATA_LENGTH;
+    else
+      return std::nullopt;
+
+    if (buf[1] != TAG_EXTENDED_ID)
+      return std::nullopt;
+
+    uint32_t id = 0;
+    for (size_t i = 0; i < 4; i++)
+      id |= static_cast<uint32_t>(buf[2 + i]) << (8 * i);
+
+    size_t const data_length = buf[6];
+    if ((data_length > max_data_length) || ((HEADER_SIZE + data_length) > size))
+      return std::nullopt;
+
+    return Frame{id & EXTENDED_ID_MASK, buf + HEADER_SIZE, data_length};
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
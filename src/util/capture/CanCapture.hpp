@@ -0,0 +1,123 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "CanCaptureBase.hpp"
+
+#include <array>
+
+#include "../file/FileSink.hpp"
+
+#include "../../Node.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class CanCapture final : public CanCaptureBase
+{
+public:
+  typedef support::platform::file::interface::FileSink FileSink;
+
+  static size_t constexpr WRITE_BUFFER_SIZE = 512;
+
+
+  CanCapture(Node & node_hdl, FileSink & file_sink)
+  : _node_hdl{node_hdl}
+  , _file_sink{file_sink}
+  , _is_failed{false}
+  , _prev_timestamp_usec{0}
+  , _buf{}
+  , _buf_size{0}
+  , _buf_num_records{0}
+  {
+    _buf_size = CaptureCodec::encodeHeader(_buf.data());
+
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~CanCapture()
+  {
+    _node_hdl.remove_updatable(this);
+    _node_hdl.remove_can_frame_tap(this);
+  }
+
+
+  /* Records are collected in a write buffer in order to write the
+   * sink in larger chunks, the buffer is written at the end of
+   * each update so that the log is complete up to that point.
+   */
+  virtual void update() override
+  {
+    for (auto record = _queue.pop(); record.has_value(); record = _queue.pop())
+    {
+      if (_is_failed) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+
+      if ((_buf_size + CaptureCodec::MAX_RECORD_SIZE) > _buf.size())
+        flush();
+
+      _buf_size += CaptureCodec::encodeRecord(_buf.data() + _buf_size, record.value(), _prev_timestamp_usec);
+      _prev_timestamp_usec = record->timestamp_usec;
+      _buf_num_records++;
+    }
+
+    flush();
+  }
+
+
+private:
+  Node & _node_hdl;
+  FileSink & _file_sink;
+  bool _is_failed;
+  CanardMicrosecond _prev_timestamp_usec;
+  std::array<uint8_t, WRITE_BUFFER_SIZE> _buf;
+  size_t _buf_size;
+  size_t _buf_num_records;
+
+
+  /* Once the sink failed the capture stops, as the
+   * records following a gap could no longer be decoded.
+   */
+  void flush()
+  {
+    if (_is_failed || (_buf_size == 0))
+      return;
+
+    if (_file_sink.write(_buf.data(), _buf_size).has_value()) {
+      _is_failed = true;
+      _dropped.fetch_add(_buf_num_records, std::memory_order_relaxed);
+    }
+
+    _buf_size = 0;
+    _buf_num_records = 0;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
@@ -0,0 +1,99 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+#include "CaptureCodec.hpp"
+#include "../queue/MpscQueue.hpp"
+#include "../../UpdatableBase.hpp"
+#include "../../CanFrameTapBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Frames are tapped from the receive path (which may execute in
+ * interrupt context) and the transmit path into a lock-free queue,
+ * the capture log itself is written from within Node::spinSome().
+ */
+class CanCaptureBase : public CanFrameTapBase, public UpdatableBase
+{
+public:
+  static size_t constexpr QUEUE_CAPACITY = 64;
+
+
+  CanCaptureBase()
+  : _queue{}
+  , _dropped{0}
+  { }
+  virtual ~CanCaptureBase() { }
+
+
+  virtual void onCanFrame(CanardFrame const & frame, CanardMicrosecond const timestamp_usec, bool const is_tx) override
+  {
+    CaptureRecord record;
+    record.timestamp_usec  = timestamp_usec;
+    record.is_tx           = is_tx;
+    record.extended_can_id = frame.extended_can_id;
+    record.payload_size    = std::min(frame.payload_size, record.payload.size());
+    std::copy_n(static_cast<uint8_t const *>(frame.payload), record.payload_size, record.payload.begin());
+
+    if (!_queue.push(record))
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /* The number of frames which were not captured, either because
+   * the queue was full or the capture log could not be written.
+   */
+  [[nodiscard]] uint32_t dropped() const
+  {
+    return _dropped.load(std::memory_order_relaxed);
+  }
+
+
+protected:
+  MpscQueue<CaptureRecord, QUEUE_CAPACITY> _queue;
+  std::atomic<uint32_t> _dropped;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using CanCapture = std::shared_ptr<impl::CanCaptureBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
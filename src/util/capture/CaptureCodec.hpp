@@ -0,0 +1,157 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <optional>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+struct CaptureRecord
+{
+  CanardMicrosecond timestamp_usec;
+  bool is_tx;
+  uint32_t extended_can_id;
+  size_t payload_size;
+  std::array<uint8_t, CANARD_MTU_CAN_FD> payload;
+};
+
+/* Encodes and decodes the append-only capture log. The log starts
+ * with a file header followed by one record per CAN frame. As the
+ * timestamps of consecutive frames are close to each other they
+ * are stored as zigzag/LEB128 encoded difference to the previous
+ * record, typically taking 1-3 bytes. Timestamps may decrease as
+ * received and transmitted frames are timestamped in different
+ * contexts.
+ *
+ * Header: "CYCAP" | uint8 version | uint16 reserved
+ * Record: uint8 flags | varint timestamp delta | uint32 CAN-ID | uint8 length | uint8[<=64] data
+ */
+class CaptureCodec
+{
+public:
+  static size_t  constexpr HEADER_SIZE     = 8;
+  static uint8_t constexpr VERSION         = 1;
+  static size_t  constexpr MAX_RECORD_SIZE = 1 + 10 + 4 + 1 + CANARD_MTU_CAN_FD;
+
+  static uint8_t constexpr FLAG_TX         = (1U << 0);
+
+
+  static size_t encodeHeader(uint8_t * const buf)
+  {
+    std::memcpy(buf, MAGIC, sizeof(MAGIC));
+    buf[5] = VERSION;
+    buf[6] = 0;
+    buf[7] = 0;
+    return HEADER_SIZE;
+  }
+
+  [[nodiscard]] static bool decodeHeader(uint8_t const * const buf, size_t const size)
+  {
+    if (size < HEADER_SIZE)
+      return false;
+    return (std::memcmp(buf, MAGIC, sizeof(MAGIC)) == 0) && (buf[5] == VERSION);
+  }
+
+  /* Returns the number of bytes of the encoded record, buf must be
+   * at least MAX_RECORD_SIZE bytes large.
+   */
+  static size_t encodeRecord(uint8_t * const buf, CaptureRecord const & record, CanardMicrosecond const prev_timestamp_usec)
+  {
+    size_t pos = 0;
+
+    buf[pos++] = record.is_tx ? FLAG_TX : 0;
+
+    int64_t const delta = static_cast<int64_t>(record.timestamp_usec - prev_timestamp_usec);
+    uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+    do
+    {
+      uint8_t const byte = zigzag & 0x7F;
+      zigzag >>= 7;
+      buf[pos++] = (zigzag > 0) ? (byte | 0x80) : byte;
+    } while (zigzag > 0);
+
+    for (size_t i = 0; i < 4; i++)
+      buf[pos++] = static_cast<uint8_t>(record.extended_can_id >> (8 * i));
+
+    size_t const payload_size = std::min(record.payload_size, record.payload.size());
+    buf[pos++] = static_cast<uint8_t>(payload_size);
+    std::memcpy(buf + pos, record.payload.data(), payload_size);
+
+    return pos + payload_size;
+  }
+
+  /* Returns the decoded record along with the number of bytes it
+   * occupies in buf or an empty optional if buf does not hold a
+   * complete record.
+   */
+  [[nodiscard]] static std::optional<std::pair<CaptureRecord, size_t>> decodeRecord(uint8_t const * const buf, size_t const size, CanardMicrosecond const prev_timestamp_usec)
+  {
+    CaptureRecord record{};
+    size_t pos = 0;
+
+    if (size < 1)
+      return std::nullopt;
+    record.is_tx = (buf[pos++] & FLAG_TX) != 0;
+
+    uint64_t zigzag = 0;
+    for (size_t shift = 0; ; shift += 7)
+    {
+      if ((pos >= size) || (shift > 63))
+        return std::nullopt;
+      uint8_t const byte = buf[pos++];
+      zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0)
+        break;
+    }
+    int64_t const delta = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+    record.timestamp_usec = prev_timestamp_usec + static_cast<CanardMicrosecond>(delta);
+
+    if ((pos + 5) > size)
+      return std::nullopt;
+    for (size_t i = 0; i < 4; i++)
+      record.extended_can_id |= static_cast<uint32_t>(buf[pos++]) << (8 * i);
+
+    record.payload_size = buf[pos++];
+    if ((record.payload_size > record.payload.size()) || ((pos + record.payload_size) > size))
+      return std::nullopt;
+    std::memcpy(record.payload.data(), buf + pos, record.payload_size);
+
+    return std::make_pair(record, pos + record.payload_size);
+  }
+
+
+private:
+  static uint8_t constexpr MAGIC[5] = {'C', 'Y', 'C', 'A', 'P'};
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
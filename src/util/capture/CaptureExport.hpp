@@ -0,0 +1,204 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <cstdio>
+#include <string_view>
+#include <algorithm>
+
+#include "CaptureReader.hpp"
+#include "../file/FileSink.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Minimal pcapng writer producing a single section with a single
+ * SocketCAN interface (timestamps in microseconds), as understood
+ * by Wireshark and the Cyphal dissectors.
+ */
+class PcapngEncoder
+{
+public:
+  static size_t   constexpr MAX_BLOCK_SIZE          = 64 + CANARD_MTU_CAN_FD;
+  static uint16_t constexpr LINKTYPE_CAN_SOCKETCAN  = 227;
+
+
+  static size_t encodeSectionHeader(uint8_t * const buf)
+  {
+    size_t pos = 0;
+    put32(buf, pos, 0x0A0D0D0A);
+    put32(buf, pos, 28);
+    put32(buf, pos, 0x1A2B3C4D);
+    put16(buf, pos, 1);
+    put16(buf, pos, 0);
+    put32(buf, pos, 0xFFFFFFFF); /* Section length unknown. */
+    put32(buf, pos, 0xFFFFFFFF);
+    put32(buf, pos, 28);
+    return pos;
+  }
+
+  static size_t encodeInterfaceDescription(uint8_t * const buf)
+  {
+    size_t pos = 0;
+    put32(buf, pos, 0x00000001);
+    put32(buf, pos, 20);
+    put16(buf, pos, LINKTYPE_CAN_SOCKETCAN);
+    put16(buf, pos, 0);
+    put32(buf, pos, 0); /* No snap length limit. */
+    put32(buf, pos, 20);
+    return pos;
+  }
+
+  /* The frame is encoded as struct can(fd)_frame with the CAN-ID in
+   * network byte order, the direction as enhanced packet flag.
+   */
+  static size_t encodeEnhancedPacket(uint8_t * const buf, CaptureRecord const & record)
+  {
+    static uint32_t constexpr CAN_EFF_FLAG = 0x80000000UL;
+    static uint8_t  constexpr CANFD_FDF    = 0x04;
+
+    size_t const packet_size = 8 + record.payload_size;
+    size_t const padded_size = (packet_size + 3) & ~static_cast<size_t>(3);
+    uint32_t const block_size = static_cast<uint32_t>(28 + padded_size + 12 + 4);
+
+    size_t pos = 0;
+    put32(buf, pos, 0x00000006);
+    put32(buf, pos, block_size);
+    put32(buf, pos, 0);
+    put32(buf, pos, static_cast<uint32_t>(record.timestamp_usec >> 32));
+    put32(buf, pos, static_cast<uint32_t>(record.timestamp_usec));
+    put32(buf, pos, static_cast<uint32_t>(packet_size));
+    put32(buf, pos, static_cast<uint32_t>(packet_size));
+
+    uint32_t const can_id = record.extended_can_id | CAN_EFF_FLAG;
+    for (size_t i = 0; i < 4; i++)
+      buf[pos++] = static_cast<uint8_t>(can_id >> (8 * (3 - i)));
+    buf[pos++] = static_cast<uint8_t>(record.payload_size);
+    buf[pos++] = (record.payload_size > 8) ? CANFD_FDF : 0;
+    buf[pos++] = 0;
+    buf[pos++] = 0;
+    std::copy_n(record.payload.cbegin(), record.payload_size, buf + pos);
+    pos += record.payload_size;
+    for (; pos < (28 + padded_size); pos++)
+      buf[pos] = 0;
+
+    /* epb_flags: inbound = 1, outbound = 2. */
+    put16(buf, pos, 2);
+    put16(buf, pos, 4);
+    put32(buf, pos, record.is_tx ? 2 : 1);
+    put32(buf, pos, 0); /* opt_endofopt */
+
+    put32(buf, pos, block_size);
+    return pos;
+  }
+
+
+private:
+  static void put16(uint8_t * const buf, size_t & pos, uint16_t const val)
+  {
+    buf[pos++] = static_cast<uint8_t>(val);
+    buf[pos++] = static_cast<uint8_t>(val >> 8);
+  }
+  static void put32(uint8_t * const buf, size_t & pos, uint32_t const val)
+  {
+    for (size_t i = 0; i < 4; i++)
+      buf[pos++] = static_cast<uint8_t>(val >> (8 * i));
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* Writes all remaining records of the capture log in the log file
+ * format of candump (-l) / canplayer, e.g.
+ *
+ *   (1680000000.123456) can0 107D552A#0102E0
+ *
+ * Returns false if the log could not be read or written completely.
+ */
+[[nodiscard]] inline bool exportCandump(CaptureReader & reader,
+                                        support::platform::file::interface::FileSink & file_sink,
+                                        std::string_view const interface_name = "can0")
+{
+  std::array<char, 64 + 2 * CANARD_MTU_CAN_FD> line;
+
+  for (auto record = reader.next(); record.has_value(); record = reader.next())
+  {
+    int len = snprintf(line.data(), line.size(), "(%llu.%06llu) %.*s %08lX#%s",
+                       static_cast<unsigned long long>(record->timestamp_usec / 1000000ULL),
+                       static_cast<unsigned long long>(record->timestamp_usec % 1000000ULL),
+                       static_cast<int>(std::min<size_t>(interface_name.size(), 16)), interface_name.data(),
+                       static_cast<unsigned long>(record->extended_can_id),
+                       (record->payload_size > 8) ? "#0" : "");
+    for (size_t i = 0; i < record->payload_size; i++)
+      len += snprintf(line.data() + len, line.size() - len, "%02X", record->payload[i]);
+    line[len++] = '\n';
+
+    if (file_sink.write(line.data(), len).has_value())
+      return false;
+  }
+
+  return reader.status() == CaptureReader::Status::EndOfLog;
+}
+
+/* Writes all remaining records of the capture log as pcapng file
+ * with one enhanced packet block per frame.
+ *
+ * Returns false if the log could not be read or written completely.
+ */
+[[nodiscard]] inline bool exportPcapng(CaptureReader & reader,
+                                       support::platform::file::interface::FileSink & file_sink)
+{
+  std::array<uint8_t, impl::PcapngEncoder::MAX_BLOCK_SIZE> block;
+
+  size_t const shb_size = impl::PcapngEncoder::encodeSectionHeader(block.data());
+  if (file_sink.write(block.data(), shb_size).has_value())
+    return false;
+
+  size_t const idb_size = impl::PcapngEncoder::encodeInterfaceDescription(block.data());
+  if (file_sink.write(block.data(), idb_size).has_value())
+    return false;
+
+  for (auto record = reader.next(); record.has_value(); record = reader.next())
+  {
+    size_t const epb_size = impl::PcapngEncoder::encodeEnhancedPacket(block.data(), record.value());
+    if (file_sink.write(block.data(), epb_size).has_value())
+      return false;
+  }
+
+  return reader.status() == CaptureReader::Status::EndOfLog;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
@@ -0,0 +1,162 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <string>
+#include <cstring>
+#include <optional>
+
+#include "CaptureCodec.hpp"
+#include "../file/FileSource.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Sequentially reads the records of a capture log written by a
+ * CanCapture, e.g. in order to replay or export them.
+ */
+class CaptureReader
+{
+public:
+  typedef support::platform::file::interface::FileSource FileSource;
+  typedef support::platform::file::Error FileSourceError;
+
+  static size_t constexpr READ_BUFFER_SIZE = 512;
+
+  enum class Status
+  {
+    Ok,
+    EndOfLog,
+    InvalidLog,
+    FileError,
+  };
+
+
+  CaptureReader(FileSource & file_source, std::string const & path)
+  : _file_source{file_source}
+  , _path{path}
+  {
+    rewind();
+  }
+  CaptureReader(CaptureReader const &) = delete;
+  CaptureReader(CaptureReader &&) = delete;
+  CaptureReader &operator=(CaptureReader const &) = delete;
+  CaptureReader &operator=(CaptureReader &&) = delete;
+
+
+  [[nodiscard]] Status status() const { return _status; }
+
+  /* Returns the next record or an empty optional once the end of
+   * the log has been reached or the log could not be read, see
+   * status().
+   */
+  [[nodiscard]] std::optional<impl::CaptureRecord> next()
+  {
+    if (_status != Status::Ok)
+      return std::nullopt;
+
+    if ((_buf_size - _buf_pos) < impl::CaptureCodec::MAX_RECORD_SIZE)
+      fill();
+
+    if (_status != Status::Ok)
+      return std::nullopt;
+
+    if (_buf_pos == _buf_size) {
+      _status = Status::EndOfLog;
+      return std::nullopt;
+    }
+
+    auto const record = impl::CaptureCodec::decodeRecord(_buf.data() + _buf_pos, _buf_size - _buf_pos, _prev_timestamp_usec);
+    if (!record.has_value()) {
+      /* The last record is incomplete if the capture was interrupted. */
+      _status = _is_eof ? Status::EndOfLog : Status::InvalidLog;
+      return std::nullopt;
+    }
+
+    _buf_pos += record->second;
+    _prev_timestamp_usec = record->first.timestamp_usec;
+    return record->first;
+  }
+
+  void rewind()
+  {
+    _status = Status::Ok;
+    _file_offset = 0;
+    _buf_pos = 0;
+    _buf_size = 0;
+    _is_eof = false;
+    _prev_timestamp_usec = 0;
+
+    fill();
+    if (_status != Status::Ok)
+      return;
+
+    if (!impl::CaptureCodec::decodeHeader(_buf.data(), _buf_size)) {
+      _status = Status::InvalidLog;
+      return;
+    }
+    _buf_pos = impl::CaptureCodec::HEADER_SIZE;
+  }
+
+
+private:
+  FileSource & _file_source;
+  std::string const _path;
+  Status _status;
+  uint64_t _file_offset;
+  std::array<uint8_t, READ_BUFFER_SIZE> _buf;
+  size_t _buf_pos;
+  size_t _buf_size;
+  bool _is_eof;
+  CanardMicrosecond _prev_timestamp_usec;
+
+
+  /* Moves the not yet decoded bytes to the start of
+   * the buffer and fills up the remainder of it.
+   */
+  void fill()
+  {
+    if (_is_eof)
+      return;
+
+    std::memmove(_buf.data(), _buf.data() + _buf_pos, _buf_size - _buf_pos);
+    _buf_size -= _buf_pos;
+    _buf_pos = 0;
+
+    size_t const size = _buf.size() - _buf_size;
+    auto const rc = _file_source.read(_path, _file_offset, size, _buf.data() + _buf_size);
+    if (std::holds_alternative<FileSourceError>(rc)) {
+      _status = Status::FileError;
+      return;
+    }
+
+    size_t const bytes_read = std::get<size_t>(rc);
+    _buf_size += bytes_read;
+    _file_offset += bytes_read;
+    _is_eof = (bytes_read < size);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
@@ -0,0 +1,128 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <optional>
+#include <algorithm>
+
+#include "CaptureReader.hpp"
+
+#include "../../Node.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Feeds the received frames of a capture log into a node while
+ * driving a simulated clock, which needs to be the micros function
+ * of the replaying node:
+ *
+ *   CaptureReplayer replayer(reader, micros, 100.0);
+ *   Node node(heap.data(), heap.size(), [&replayer]() { return replayer.micros(); }, ...);
+ *   while (replayer.spinSome(node)) { }
+ *
+ * The simulated clock starts at the timestamp of the first record
+ * and runs speed times faster than the wall clock, a speed of zero
+ * replays the log as fast as possible. Each frame is delivered at
+ * its recorded time, followed by a Node::spinSome(), so timeouts of
+ * the replaying node behave exactly as during the capture. Frames
+ * transmitted by the capturing node are not replayed.
+ */
+class CaptureReplayer
+{
+public:
+  /* Bounds the time spent in a single spinSome() when the
+   * replay falls behind, e.g. at very high speeds.
+   */
+  static size_t constexpr MAX_RECORDS_PER_SPIN = 64;
+
+
+  CaptureReplayer(CaptureReader & reader, Node::MicrosFunc const wall_micros_func, double const speed)
+  : _reader{reader}
+  , _wall_micros_func{wall_micros_func}
+  , _speed{std::max(speed, 0.0)}
+  , _next{reader.next()}
+  , _sim_start_usec{_next.has_value() ? _next->timestamp_usec : 0}
+  , _sim_now_usec{_sim_start_usec}
+  , _wall_start_usec{std::nullopt}
+  { }
+  CaptureReplayer(CaptureReplayer const &) = delete;
+  CaptureReplayer(CaptureReplayer &&) = delete;
+  CaptureReplayer &operator=(CaptureReplayer const &) = delete;
+  CaptureReplayer &operator=(CaptureReplayer &&) = delete;
+
+
+  /* The simulated clock, monotonic even if the
+   * recorded timestamps are not strictly ordered.
+   */
+  [[nodiscard]] CanardMicrosecond micros() const { return _sim_now_usec; }
+
+  [[nodiscard]] bool is_finished() const { return !_next.has_value(); }
+
+  /* Returns false once all records have been replayed. */
+  bool spinSome(Node & node)
+  {
+    if (is_finished())
+      return false;
+
+    if (!_wall_start_usec.has_value())
+      _wall_start_usec = _wall_micros_func();
+
+    CanardMicrosecond const target_usec = (_speed > 0.0) ?
+      _sim_start_usec + static_cast<CanardMicrosecond>(static_cast<double>(_wall_micros_func() - _wall_start_usec.value()) * _speed) :
+      _next->timestamp_usec;
+
+    for (size_t n = 0; (n < MAX_RECORDS_PER_SPIN) && _next.has_value() && (_next->timestamp_usec <= target_usec); n++)
+    {
+      _sim_now_usec = std::max(_sim_now_usec, _next->timestamp_usec);
+
+      if (!_next->is_tx)
+      {
+        CanardFrame const frame{_next->extended_can_id, _next->payload_size, _next->payload.data()};
+        node.onCanFrameReceived(frame);
+        node.spinSome();
+      }
+
+      _next = _reader.next();
+    }
+
+    /* The clock must not overtake records which are still due. */
+    if (!_next.has_value() || (_next->timestamp_usec > target_usec))
+      _sim_now_usec = std::max(_sim_now_usec, target_usec);
+    node.spinSome();
+
+    return !is_finished();
+  }
+
+
+private:
+  CaptureReader & _reader;
+  Node::MicrosFunc const _wall_micros_func;
+  double const _speed;
+  std::optional<impl::CaptureRecord> _next;
+  CanardMicrosecond const _sim_start_usec;
+  CanardMicrosecond _sim_now_usec;
+  std::optional<CanardMicrosecond> _wall_start_usec;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
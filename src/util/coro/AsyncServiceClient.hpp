@@ -0,0 +1,131 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine)
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "AsyncServiceClientBase.hpp"
+
+#include <array>
+
+#include "../../Node.hpp"
+
+#undef max
+#undef min
+#include <nunavut/support/serialization.hpp>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+template <typename T_REQ, typename T_RSP>
+class AsyncServiceClient final : public AsyncServiceClientBase<T_REQ, T_RSP>
+{
+public:
+  typedef typename AsyncServiceClientBase<T_REQ, T_RSP>::Response Response;
+
+
+  AsyncServiceClient(Node & node_hdl,
+                     Node::MicrosFunc const micros_func,
+                     CanardPortID const port_id,
+                     CanardMicrosecond const tx_timeout_usec,
+                     CanardMicrosecond const response_timeout_usec)
+  : _node_hdl{node_hdl}
+  , _micros_func{micros_func}
+  , _port_id{port_id}
+  , _tx_timeout_usec{tx_timeout_usec}
+  , _response_timeout_usec{response_timeout_usec}
+  , _transfer_id{0}
+  {
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~AsyncServiceClient()
+  {
+    _node_hdl.remove_updatable(this);
+    _node_hdl.unsubscribe(_port_id, SubscriptionBase::canard_transfer_kind(), *this);
+  }
+
+
+  [[nodiscard]] virtual Response request(CanardNodeID const remote_node_id, T_REQ const & req) override
+  {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    CanardTransferMetadata const transfer_metadata =
+    {
+      .priority       = CanardPriorityNominal,
+      .transfer_kind  = CanardTransferKindRequest,
+      .port_id        = _port_id,
+      .remote_node_id = remote_node_id,
+      .transfer_id    = _transfer_id++,
+    };
+#pragma GCC diagnostic pop
+
+    std::array<uint8_t, T_REQ::_traits_::SerializationBufferSizeBytes> req_buf;
+    nunavut::support::bitspan req_buf_bitspan{req_buf};
+    auto const rc = serialize(req, req_buf_bitspan);
+    if (!rc)
+      return this->makeFailedResponse();
+
+    if (!_node_hdl.enqueue_transfer(_tx_timeout_usec, &transfer_metadata, *rc, req_buf.data()))
+      return this->makeFailedResponse();
+
+    return this->makeResponse(remote_node_id, transfer_metadata.transfer_id, _micros_func() + _response_timeout_usec);
+  }
+
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    return this->complete(transfer.metadata.remote_node_id,
+                          transfer.metadata.transfer_id,
+                          [&transfer]() -> std::optional<T_RSP>
+                          {
+                            T_RSP rsp;
+                            nunavut::support::const_bitspan rsp_bitspan(static_cast<uint8_t *>(transfer.payload), transfer.payload_size);
+                            if (!deserialize(rsp, rsp_bitspan))
+                              return std::nullopt;
+                            return rsp;
+                          });
+  }
+
+  virtual void update() override
+  {
+    this->expire(_micros_func());
+  }
+
+
+private:
+  Node & _node_hdl;
+  Node::MicrosFunc const _micros_func;
+  CanardPortID const _port_id;
+  CanardMicrosecond const _tx_timeout_usec;
+  CanardMicrosecond const _response_timeout_usec;
+  CanardTransferID _transfer_id;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
+
+#endif /* __cpp_impl_coroutine */
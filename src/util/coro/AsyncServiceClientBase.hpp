@@ -0,0 +1,206 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine)
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <optional>
+#include <coroutine>
+
+#include <libcanard/canard.h>
+
+#include "Task.hpp"
+#include "../../UpdatableBase.hpp"
+#include "../../SubscriptionBase.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* A service client for coroutines, see coro::Task. Up to
+ * MAX_PENDING_REQUESTS requests may be awaited concurrently,
+ * each response is matched to its request via the server
+ * node-ID and the transfer-ID.
+ */
+template <typename T_REQ, typename T_RSP>
+class AsyncServiceClientBase : public SubscriptionBase, public UpdatableBase
+{
+public:
+  static size_t constexpr MAX_PENDING_REQUESTS = 8;
+
+  /* Awaiting a response yields the response, or std::nullopt if
+   * the request could not be sent, was not answered in time or
+   * too many requests are pending. A response needs to be awaited
+   * right away as it is only registered once the coroutine has
+   * been suspended.
+   */
+  class Response
+  {
+  public:
+    Response(Response const &) = delete;
+    Response(Response &&) = delete;
+    Response &operator=(Response const &) = delete;
+    Response &operator=(Response &&) = delete;
+    ~Response()
+    {
+      if (_is_pending)
+        _client->cancel(*this);
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept { return (_client == nullptr); }
+    [[nodiscard]] bool await_suspend(std::coroutine_handle<> const handle) noexcept
+    {
+      _handle = handle;
+      return _client->attach(*this);
+    }
+    [[nodiscard]] std::optional<T_RSP> await_resume() { return std::move(_rsp); }
+
+  private:
+    friend class AsyncServiceClientBase;
+
+    Response(AsyncServiceClientBase * const client, CanardNodeID const remote_node_id, CanardTransferID const transfer_id, CanardMicrosecond const deadline_usec)
+    : _client{client}
+    , _remote_node_id{remote_node_id}
+    , _transfer_id{transfer_id}
+    , _deadline_usec{deadline_usec}
+    , _handle{nullptr}
+    , _is_pending{false}
+    , _rsp{std::nullopt}
+    { }
+
+    AsyncServiceClientBase * const _client;
+    CanardNodeID const _remote_node_id;
+    CanardTransferID const _transfer_id;
+    CanardMicrosecond const _deadline_usec;
+    std::coroutine_handle<> _handle;
+    bool _is_pending;
+    std::optional<T_RSP> _rsp;
+  };
+
+
+  AsyncServiceClientBase()
+  : SubscriptionBase{CanardTransferKindResponse}
+  , _pending{}
+  { }
+  /* Coroutines still awaiting a response are never resumed. */
+  virtual ~AsyncServiceClientBase()
+  {
+    for (auto rsp : _pending)
+      if (rsp)
+        rsp->_is_pending = false;
+  }
+
+
+  [[nodiscard]] virtual Response request(CanardNodeID const remote_node_id, T_REQ const & req) = 0;
+
+
+protected:
+  [[nodiscard]] Response makeResponse(CanardNodeID const remote_node_id, CanardTransferID const transfer_id, CanardMicrosecond const deadline_usec)
+  {
+    return Response{this, remote_node_id, transfer_id, deadline_usec};
+  }
+  [[nodiscard]] static Response makeFailedResponse()
+  {
+    return Response{nullptr, 0, 0, 0};
+  }
+
+  /* Resumes the coroutine awaiting the response with the given
+   * transfer-ID, which is obtained from decode() returning an
+   * std::optional<T_RSP>.
+   */
+  template <typename Decode>
+  bool complete(CanardNodeID const remote_node_id, CanardTransferID const transfer_id, Decode && decode)
+  {
+    for (auto & pending : _pending)
+    {
+      if (!pending || (pending->_remote_node_id != remote_node_id) || ((pending->_transfer_id ^ transfer_id) & CANARD_TRANSFER_ID_MAX))
+        continue;
+
+      Response * rsp = std::exchange(pending, nullptr);
+      rsp->_is_pending = false;
+      rsp->_rsp = decode();
+      rsp->_handle.resume();
+      return true;
+    }
+    return false;
+  }
+
+  /* Resumes all coroutines whose response has not arrived in time. */
+  void expire(CanardMicrosecond const now_usec)
+  {
+    for (auto & pending : _pending)
+    {
+      if (!pending || (now_usec <= pending->_deadline_usec))
+        continue;
+
+      Response * rsp = std::exchange(pending, nullptr);
+      rsp->_is_pending = false;
+      rsp->_handle.resume();
+    }
+  }
+
+
+private:
+  std::array<Response *, MAX_PENDING_REQUESTS> _pending;
+
+  bool attach(Response & rsp)
+  {
+    for (auto & pending : _pending)
+      if (!pending) {
+        pending = &rsp;
+        rsp._is_pending = true;
+        return true;
+      }
+    return false;
+  }
+
+  void cancel(Response & rsp)
+  {
+    for (auto & pending : _pending)
+      if (pending == &rsp)
+        pending = nullptr;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+template <typename T_REQ, typename T_RSP>
+using AsyncServiceClient = std::shared_ptr<impl::AsyncServiceClientBase<T_REQ, T_RSP>>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
+
+#endif /* __cpp_impl_coroutine */
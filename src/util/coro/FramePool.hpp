@@ -0,0 +1,134 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstddef>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::coro
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Provides the memory for coroutine frames, see Task. Each frame
+ * is preceded by a header referring to the pool it was allocated
+ * from, so that it can be released without knowing the pool.
+ */
+class FramePoolBase
+{
+public:
+  virtual ~FramePoolBase() { }
+
+
+  /* Returns nullptr if no frame of the requested size is available. */
+  [[nodiscard]] void * allocate(size_t const size) noexcept
+  {
+    void * block = allocateBlock(HEADER_SIZE + size);
+    if (!block)
+      return nullptr;
+
+    *static_cast<FramePoolBase **>(block) = this;
+    return static_cast<uint8_t *>(block) + HEADER_SIZE;
+  }
+
+  static void deallocate(void * const frame) noexcept
+  {
+    void * block = static_cast<uint8_t *>(frame) - HEADER_SIZE;
+    (*static_cast<FramePoolBase **>(block))->deallocateBlock(block);
+  }
+
+
+protected:
+  static size_t constexpr HEADER_SIZE = alignof(std::max_align_t);
+
+  virtual void * allocateBlock(size_t const size) noexcept = 0;
+  virtual void deallocateBlock(void * const block) noexcept = 0;
+};
+
+/* A fixed number of equally sized frames. The frame size needed
+ * by a coroutine depends on its local variables and the compiler,
+ * a coroutine whose frame does not fit is not started at all.
+ */
+template <size_t FRAME_SIZE, size_t NUM_FRAMES>
+class FramePool final : public FramePoolBase
+{
+  static_assert(NUM_FRAMES <= 32, "NUM_FRAMES must not exceed 32");
+
+public:
+  FramePool()
+  : _blocks{}
+  , _used_mask{0}
+  { }
+  FramePool(FramePool const &) = delete;
+  FramePool(FramePool &&) = delete;
+  FramePool &operator=(FramePool const &) = delete;
+  FramePool &operator=(FramePool &&) = delete;
+
+
+  [[nodiscard]] size_t available() const
+  {
+    size_t num_available = 0;
+    for (size_t i = 0; i < NUM_FRAMES; i++)
+      if (!(_used_mask & (1UL << i)))
+        num_available++;
+    return num_available;
+  }
+
+
+protected:
+  virtual void * allocateBlock(size_t const size) noexcept override
+  {
+    if (size > BLOCK_SIZE)
+      return nullptr;
+
+    for (size_t i = 0; i < NUM_FRAMES; i++)
+      if (!(_used_mask & (1UL << i))) {
+        _used_mask |= (1UL << i);
+        return _blocks[i].data;
+      }
+
+    return nullptr;
+  }
+
+  virtual void deallocateBlock(void * const block) noexcept override
+  {
+    for (size_t i = 0; i < NUM_FRAMES; i++)
+      if (_blocks[i].data == block)
+        _used_mask &= ~(1UL << i);
+  }
+
+
+private:
+  static size_t constexpr BLOCK_SIZE = HEADER_SIZE + FRAME_SIZE;
+
+  struct Block
+  {
+    alignas(std::max_align_t) uint8_t data[BLOCK_SIZE];
+  };
+
+  std::array<Block, NUM_FRAMES> _blocks;
+  uint32_t _used_mask;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::coro */
@@ -0,0 +1,148 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine)
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <utility>
+#include <exception>
+#include <coroutine>
+#include <type_traits>
+
+#include "FramePool.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::coro
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* The result of a coroutine, which starts executing immediately
+ * and is resumed from within Node::spinSome() whenever an awaited
+ * operation (e.g. AsyncServiceClient::request()) completes. The
+ * frame of the coroutine is allocated from the frame pool passed
+ * as its first parameter (or its second one, for lambdas and
+ * member functions), no other memory is allocated:
+ *
+ *   cyphal::coro::Task read_info(cyphal::coro::FramePoolBase &, AsyncClient & clt)
+ *   {
+ *     auto const rsp = co_await clt->request(42, GetInfo::Request_1_0{});
+ *     ...
+ *   }
+ *
+ * Destroying the task destroys the coroutine, even if suspended.
+ */
+class Task
+{
+public:
+  /* The promise type of a coroutine with the parameters Args, see
+   * std::coroutine_traits<Task, Args...> below. The frame is
+   * allocated by a non-template operator new taking exactly these
+   * parameters, so that it is paired with the operator delete
+   * releasing the frame.
+   */
+  template <typename... Args>
+  struct promise_type
+  {
+    Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+    static Task get_return_object_on_allocation_failure() { return Task{}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() { }
+    void unhandled_exception() { std::terminate(); }
+
+    static void * operator new(size_t const size, Args const &... args) noexcept { return framePool(args...).allocate(size); }
+    static void operator delete(void * const frame, size_t const) noexcept { FramePoolBase::deallocate(frame); }
+  };
+
+
+  Task() : _handle{nullptr} { }
+  Task(Task && other) noexcept : _handle{std::exchange(other._handle, nullptr)} { }
+  Task &operator=(Task && other) noexcept
+  {
+    if (this != &other) {
+      reset();
+      _handle = std::exchange(other._handle, nullptr);
+    }
+    return *this;
+  }
+  Task(Task const &) = delete;
+  Task &operator=(Task const &) = delete;
+  ~Task() { reset(); }
+
+
+  /* False if the coroutine could not be started because
+   * no frame was available in the frame pool.
+   */
+  [[nodiscard]] bool valid() const { return static_cast<bool>(_handle); }
+  [[nodiscard]] bool done() const { return _handle && _handle.done(); }
+
+
+private:
+  std::coroutine_handle<> _handle;
+
+  explicit Task(std::coroutine_handle<> const handle) : _handle{handle} { }
+
+  void reset()
+  {
+    if (_handle)
+      _handle.destroy();
+    _handle = nullptr;
+  }
+
+  /* The frame pool is the first parameter, or the second one
+   * following the object of a lambda or member function.
+   */
+  template <typename First, typename... Rest>
+  static FramePoolBase & framePool(First & first, Rest &... rest)
+  {
+    if constexpr (std::is_convertible_v<First &, FramePoolBase &>)
+      return first;
+    else
+      return framePoolAfterObject(rest...);
+  }
+  template <typename... Rest>
+  static FramePoolBase & framePoolAfterObject(Rest &... rest)
+  {
+    static_assert(sizeof...(Rest) > 0, "The first parameter of a coroutine returning cyphal::coro::Task needs to be a cyphal::coro::FramePoolBase &");
+    return framePoolSecond(rest...);
+  }
+  template <typename Second, typename... Rest>
+  static FramePoolBase & framePoolSecond(Second & second, Rest &...)
+  {
+    static_assert(std::is_convertible_v<Second &, FramePoolBase &>, "The first parameter of a coroutine returning cyphal::coro::Task needs to be a cyphal::coro::FramePoolBase &");
+    return second;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::coro */
+
+/**************************************************************************************
+ * SPECIALIZATION
+ **************************************************************************************/
+
+template <typename... Args>
+struct std::coroutine_traits<cyphal::coro::Task, Args...>
+{
+  using promise_type = cyphal::coro::Task::promise_type<Args...>;
+};
+
+#endif /* __cpp_impl_coroutine */
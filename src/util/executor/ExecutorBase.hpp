@@ -0,0 +1,189 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstring>
+
+#include <libcanard/canard.h>
+
+#include "../queue/MpscQueue.hpp"
+#include "../../SubscriptionBase.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Executes the callbacks of the subscriptions bound to it on a
+ * separate (worker) thread: transfers are still received and
+ * reassembled within Node::spinSome(), the completed transfer is
+ * then copied into one of QUEUE_CAPACITY slots and the slot is
+ * handed over to the worker via a lock-free queue. The worker
+ * deserializes and invokes the callback from within spinSome()
+ * and hands the slot back via a second queue, so that the payload
+ * buffers are reused. Transfers arriving while all slots are in
+ * use are dropped. Several executors can be used to spread the
+ * subscriptions of a node across multiple cores.
+ *
+ * Subscriptions bound to an executor need to be created and
+ * destroyed from the thread calling Node::spinSome(), but never
+ * from within a callback executed by the executor.
+ */
+class ExecutorBase
+{
+public:
+  static size_t constexpr QUEUE_CAPACITY = 32;
+
+
+  ExecutorBase()
+  : _slots{}
+  , _pending{}
+  , _free{}
+  , _is_executing{false}
+  , _dropped{0}
+  {
+    for (size_t i = 0; i < QUEUE_CAPACITY; i++)
+      (void)_free.push(i);
+  }
+  ExecutorBase(ExecutorBase const &) = delete;
+  ExecutorBase(ExecutorBase &&) = delete;
+  ExecutorBase &operator=(ExecutorBase const &) = delete;
+  ExecutorBase &operator=(ExecutorBase &&) = delete;
+
+
+  /* Must be called from the worker thread. Executes all pending
+   * transfers and returns the number of invoked callbacks.
+   */
+  size_t spinSome()
+  {
+    size_t num_executed = 0;
+
+    for (auto idx = _pending.pop(); idx.has_value(); idx = _pending.pop())
+    {
+      Slot & slot = _slots[idx.value()];
+
+      /* Signalled before the subscription is claimed, see cancel(). */
+      _is_executing.store(true);
+      SubscriptionBase * sub = slot.sub.exchange(nullptr);
+      if (sub) {
+        (void)sub->onTransferExecuted(slot.transfer);
+        num_executed++;
+      }
+      _is_executing.store(false);
+
+      (void)_free.push(idx.value());
+    }
+
+    return num_executed;
+  }
+
+  /* The number of transfers which were dropped because all
+   * slots were in use.
+   */
+  [[nodiscard]] uint32_t dropped() const
+  {
+    return _dropped.load(std::memory_order_relaxed);
+  }
+
+
+  /* Called from within Node::spinSome() with a completed transfer,
+   * whose payload is only valid for the duration of the call.
+   */
+  bool post(SubscriptionBase & sub, CanardRxTransfer const & transfer)
+  {
+    auto const idx = _free.pop();
+    if (!idx.has_value()) {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    /* The payload buffer of a slot only grows, so that no more
+     * allocations are needed once all slots have been used.
+     */
+    Slot & slot = _slots[idx.value()];
+    if (slot.payload.size() < transfer.payload_size)
+      slot.payload.resize(transfer.payload_size);
+    if (transfer.payload_size > 0)
+      std::memcpy(slot.payload.data(), transfer.payload, transfer.payload_size);
+
+    slot.transfer = transfer;
+    slot.transfer.payload = slot.payload.data();
+    slot.sub.store(&sub);
+
+    (void)_pending.push(idx.value());
+    return true;
+  }
+
+  /* Called by a subscription upon its destruction. Discards all
+   * of its pending transfers and waits until none of its callbacks
+   * is executing anymore.
+   */
+  void cancel(SubscriptionBase & sub)
+  {
+    for (auto & slot : _slots)
+    {
+      SubscriptionBase * expected = &sub;
+      (void)slot.sub.compare_exchange_strong(expected, nullptr);
+    }
+
+    while (_is_executing.load())
+    { }
+  }
+
+
+private:
+  struct Slot
+  {
+    std::atomic<SubscriptionBase *> sub{nullptr};
+    CanardRxTransfer transfer{};
+    std::vector<uint8_t> payload{};
+  };
+
+  std::array<Slot, QUEUE_CAPACITY> _slots;
+  /* Slots ready to be executed by the worker. */
+  MpscQueue<size_t, QUEUE_CAPACITY> _pending;
+  /* Slots handed back by the worker. */
+  MpscQueue<size_t, QUEUE_CAPACITY> _free;
+  std::atomic<bool> _is_executing;
+  std::atomic<uint32_t> _dropped;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using Executor = std::shared_ptr<impl::ExecutorBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
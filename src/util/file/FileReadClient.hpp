@@ -0,0 +1,363 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "FileReadClientBase.hpp"
+
+#include <array>
+#include <string>
+#include <cstring>
+#include <optional>
+#include <algorithm>
+
+#include "ReadCodec.hpp"
+#include "FileSink.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/file.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class FileReadClient final : public FileReadClientBase
+{
+public:
+  typedef uavcan::file::Read::Response_1_1 TReadResponse;
+  typedef uavcan::file::Error_1_0 TError;
+  typedef support::platform::file::interface::FileSink FileSink;
+
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec       = 1000*1000UL;
+  static CanardMicrosecond constexpr RESPONSE_TIMEOUT_usec = 1000*1000UL;
+  static uint8_t           constexpr MAX_RETRIES           = 3;
+
+  static_assert(MAX_WINDOW_SIZE <= CANARD_TRANSFER_ID_MAX, "the transfer-IDs of all in-flight requests need to be distinct");
+  static_assert(Node::DEFAULT_FILE_READ_WINDOW_SIZE <= MAX_WINDOW_SIZE, "the default window exceeds the maximum window");
+
+
+  FileReadClient(Node & node_hdl,
+                 cyphal::Node::MicrosFunc const micros_func,
+                 CanardNodeID const server_node_id,
+                 std::string const & path,
+                 FileSink & file_sink,
+                 size_t const window_size)
+  : _node_hdl{node_hdl}
+  , _micros_func{micros_func}
+  , _server_node_id{server_node_id}
+  , _path{path}
+  , _file_sink{file_sink}
+  , _window_size{std::clamp<size_t>(window_size, 1, MAX_WINDOW_SIZE)}
+  , _slots{}
+  , _status{Status::InProgress}
+  , _error{TError::OK}
+  , _transfer_id{0}
+  , _quarantined_transfer_ids{0}
+  , _quarantine_deadline_usec{}
+  , _request_offset{0}
+  , _write_offset{0}
+  , _eof_offset{std::nullopt}
+  {
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~FileReadClient()
+  {
+    _node_hdl.remove_updatable(this);
+    _node_hdl.unsubscribe(TReadResponse::_traits_::FixedPortId, SubscriptionBase::canard_transfer_kind(), *this);
+  }
+
+
+  [[nodiscard]] virtual Status status() const override { return _status; }
+  [[nodiscard]] virtual uint64_t offset() const override { return _write_offset; }
+  [[nodiscard]] virtual uint16_t error() const override { return _error; }
+
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    if ((_status != Status::InProgress) || (transfer.metadata.remote_node_id != _server_node_id))
+      return false;
+
+    /* Responses are matched to their request via the transfer-ID
+     * as they carry no offset, hence all in-flight requests need
+     * to have distinct transfer-IDs, see nextTransferId().
+     */
+    auto slot = std::find_if(_slots.begin(),
+                             _slots.begin() + _window_size,
+                             [&transfer](Slot const & s)
+                             {
+                               return s.is_busy && !s.is_received && (s.transfer_id == transfer.metadata.transfer_id);
+                             });
+    if (slot == (_slots.begin() + _window_size))
+      return false;
+
+    auto const rsp = ReadCodec::decodeResponse(static_cast<uint8_t const *>(transfer.payload), transfer.payload_size);
+    if (!rsp.has_value())
+      return false;
+
+    if (rsp->error != TError::OK) {
+      fail(rsp->error);
+      return false;
+    }
+
+    /* A short read marks the end of the file. */
+    if (rsp->data_length < ReadCodec::MAX_DATA_LENGTH)
+    {
+      uint64_t const eof_offset = slot->offset + rsp->data_length;
+      if (!_eof_offset.has_value() || (eof_offset < _eof_offset.value()))
+        _eof_offset = eof_offset;
+    }
+
+    /* Only out-of-order responses need to be buffered,
+     * the next expected chunk goes straight to the sink.
+     */
+    if (slot->offset == _write_offset)
+    {
+      release(*slot, true);
+      if (!write(rsp->data, rsp->data_length))
+        return false;
+      flush();
+    }
+    else
+    {
+      std::copy(rsp->data, rsp->data + rsp->data_length, slot->data.begin());
+      slot->data_length = rsp->data_length;
+      slot->is_received = true;
+    }
+
+    return true;
+  }
+
+  virtual void update() override
+  {
+    if (_status != Status::InProgress)
+      return;
+
+    auto const now = _micros_func();
+
+    for (size_t i = 0; (i < _window_size) && (_status == Status::InProgress); i++)
+    {
+      Slot & slot = _slots[i];
+
+      /* Requests beyond the end of the file are abandoned. */
+      if (slot.is_busy && _eof_offset.has_value() && (slot.offset >= _eof_offset.value()))
+        release(slot, slot.is_received);
+
+      if (slot.is_busy && !slot.is_received && (now > slot.deadline_usec))
+      {
+        if (slot.retries >= MAX_RETRIES)
+          fail(TError::UNKNOWN_ERROR);
+        else {
+          auto const transfer_id = nextTransferId(now);
+          if (!transfer_id.has_value())
+            continue;
+
+          quarantine(slot.transfer_id, now + RESPONSE_TIMEOUT_usec);
+          slot.retries++;
+          slot.transfer_id = transfer_id.value();
+          request(slot, now);
+        }
+      }
+
+      if (!slot.is_busy && (!_eof_offset.has_value() || (_request_offset < _eof_offset.value())))
+      {
+        auto const transfer_id = nextTransferId(now);
+        if (!transfer_id.has_value())
+          continue;
+
+        slot.is_busy     = true;
+        slot.is_received = false;
+        slot.retries     = 0;
+        slot.transfer_id = transfer_id.value();
+        slot.offset      = _request_offset;
+        _request_offset += ReadCodec::MAX_DATA_LENGTH;
+        request(slot, now);
+      }
+    }
+  }
+
+
+private:
+  struct Slot
+  {
+    bool is_busy;
+    bool is_received;
+    uint8_t retries;
+    CanardTransferID transfer_id;
+    uint64_t offset;
+    CanardMicrosecond deadline_usec;
+    size_t data_length;
+    std::array<uint8_t, ReadCodec::MAX_DATA_LENGTH> data;
+  };
+
+  Node & _node_hdl;
+  cyphal::Node::MicrosFunc const _micros_func;
+  CanardNodeID const _server_node_id;
+  std::string const _path;
+  FileSink & _file_sink;
+  size_t const _window_size;
+  std::array<Slot, MAX_WINDOW_SIZE> _slots;
+  Status _status;
+  uint16_t _error;
+  CanardTransferID _transfer_id;
+  uint32_t _quarantined_transfer_ids;
+  std::array<CanardMicrosecond, CANARD_TRANSFER_ID_MAX + 1> _quarantine_deadline_usec;
+  uint64_t _request_offset;
+  uint64_t _write_offset;
+  std::optional<uint64_t> _eof_offset;
+
+
+  /* Each attempt is sent with a fresh transfer-ID: within its
+   * transfer-ID timeout (2 s by default) the server drops a request
+   * repeating the transfer-ID of its predecessor as a duplicate,
+   * i.e. a retry after a lost response would never be answered.
+   */
+  void request(Slot & slot, CanardMicrosecond const now)
+  {
+    slot.deadline_usec = now + RESPONSE_TIMEOUT_usec;
+
+    std::array<uint8_t, ReadCodec::REQUEST_BUFFER_SIZE> req_buf;
+    auto const req_size = ReadCodec::encodeRequest(req_buf.data(), slot.offset, _path);
+    if (!req_size.has_value()) {
+      fail(TError::INVALID_VALUE);
+      return;
+    }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    CanardTransferMetadata const transfer_metadata =
+    {
+      .priority       = CanardPriorityNominal,
+      .transfer_kind  = CanardTransferKindRequest,
+      .port_id        = TReadResponse::_traits_::FixedPortId,
+      .remote_node_id = _server_node_id,
+      .transfer_id    = slot.transfer_id,
+    };
+#pragma GCC diagnostic pop
+
+    /* A request which could not be enqueued is
+     * retried once its response timeout expires.
+     */
+    (void)_node_hdl.enqueue_transfer(TX_TIMEOUT_usec,
+                                     &transfer_metadata,
+                                     req_size.value(),
+                                     req_buf.data());
+  }
+
+  /* Returns a transfer-ID which is neither used by an in-flight
+   * request nor possibly still answered for an earlier one, or
+   * std::nullopt if all of them are (the window is smaller than
+   * the transfer-ID space, hence this only happens temporarily
+   * after many retries).
+   */
+  std::optional<CanardTransferID> nextTransferId(CanardMicrosecond const now)
+  {
+    for (size_t i = 0; i <= CANARD_TRANSFER_ID_MAX; i++)
+    {
+      CanardTransferID const tid = (_transfer_id + i) & CANARD_TRANSFER_ID_MAX;
+      uint32_t const tid_mask = 1UL << tid;
+
+      if ((_quarantined_transfer_ids & tid_mask) && (now > _quarantine_deadline_usec[tid]))
+        _quarantined_transfer_ids &= ~tid_mask;
+      if (_quarantined_transfer_ids & tid_mask)
+        continue;
+
+      bool const is_in_flight = std::any_of(_slots.begin(),
+                                            _slots.begin() + _window_size,
+                                            [tid](Slot const & s) { return s.is_busy && (s.transfer_id == tid); });
+      if (is_in_flight)
+        continue;
+
+      _transfer_id = (tid + 1) & CANARD_TRANSFER_ID_MAX;
+      return tid;
+    }
+    return std::nullopt;
+  }
+
+  /* A request which was never answered might still be answered,
+   * its transfer-ID is not reused until its response timeout expired.
+   */
+  void release(Slot & slot, bool const is_answered)
+  {
+    if (!is_answered)
+      quarantine(slot.transfer_id, slot.deadline_usec);
+    slot.is_busy = false;
+  }
+
+  /* Late responses to a quarantined transfer-ID match no request,
+   * see nextTransferId(), and are therefore dropped.
+   */
+  void quarantine(CanardTransferID const transfer_id, CanardMicrosecond const deadline_usec)
+  {
+    _quarantined_transfer_ids |= (1UL << transfer_id);
+    _quarantine_deadline_usec[transfer_id] = deadline_usec;
+  }
+
+  bool write(uint8_t const * const data, size_t const data_length)
+  {
+    if (data_length > 0)
+    {
+      if (_file_sink.write(data, data_length).has_value()) {
+        fail(TError::IO_ERROR);
+        return false;
+      }
+      _write_offset += data_length;
+    }
+
+    if (_eof_offset.has_value() && (_write_offset >= _eof_offset.value()))
+      _status = Status::Done;
+
+    return true;
+  }
+
+  /* Writes all buffered chunks which are now in order. */
+  void flush()
+  {
+    for (bool is_flushed = false; !is_flushed && (_status == Status::InProgress); )
+    {
+      auto slot = std::find_if(_slots.begin(),
+                               _slots.begin() + _window_size,
+                               [this](Slot const & s)
+                               {
+                                 return s.is_busy && s.is_received && (s.offset == _write_offset);
+                               });
+      is_flushed = (slot == (_slots.begin() + _window_size));
+      if (!is_flushed)
+      {
+        release(*slot, true);
+        if (!write(slot->data.data(), slot->data_length))
+          return;
+      }
+    }
+  }
+
+  void fail(uint16_t const error)
+  {
+    _status = Status::Failed;
+    _error = error;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
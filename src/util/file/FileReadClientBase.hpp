@@ -0,0 +1,72 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <memory>
+
+#include "../../SubscriptionBase.h"
+#include "../../UpdatableBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class FileReadClientBase : public SubscriptionBase, public UpdatableBase
+{
+public:
+  static size_t constexpr MAX_WINDOW_SIZE = 16;
+
+  enum class Status
+  {
+    InProgress,
+    Done,
+    Failed,
+  };
+
+
+  FileReadClientBase() : SubscriptionBase{CanardTransferKindResponse} { }
+  virtual ~FileReadClientBase() { }
+
+  [[nodiscard]] virtual Status status() const = 0;
+  /* The number of bytes already written to the file sink. */
+  [[nodiscard]] virtual uint64_t offset() const = 0;
+  /* The uavcan.file.Error reported by the server, if any. */
+  [[nodiscard]] virtual uint16_t error() const = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using FileReadClient = std::shared_ptr<impl::FileReadClientBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
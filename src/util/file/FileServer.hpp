@@ -0,0 +1,144 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "FileServerBase.hpp"
+
+#include <array>
+#include <bitset>
+
+#include "ReadCodec.hpp"
+#include "FileSource.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/file.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class FileServer final : public FileServerBase
+{
+public:
+  typedef uavcan::file::Read::Request_1_1 TReadRequest;
+  typedef uavcan::file::Error_1_0 TError;
+  typedef support::platform::file::interface::FileSource FileSource;
+  typedef support::platform::file::Error FileSourceError;
+
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec = 1000*1000UL;
+
+
+  FileServer(Node & node_hdl, FileSource & file_source)
+  : _node_hdl{node_hdl}
+  , _file_source{file_source}
+  , _rsp_buf{}
+  , _read_offset{}
+  , _is_reading{}
+  { }
+
+  virtual ~FileServer()
+  {
+    _node_hdl.unsubscribe(TReadRequest::_traits_::FixedPortId, SubscriptionBase::canard_transfer_kind(), *this);
+  }
+
+
+  [[nodiscard]] virtual std::optional<uint64_t> read_offset(CanardNodeID const remote_node_id) const override
+  {
+    if ((remote_node_id > CANARD_NODE_ID_MAX) || !_is_reading.test(remote_node_id))
+      return std::nullopt;
+    return _read_offset[remote_node_id];
+  }
+
+  /* Requests are served immediately from within the receive path,
+   * therefore a single response buffer is shared by all readers
+   * and no per-request or per-reader memory needs to be allocated.
+   */
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    auto const req = ReadCodec::decodeRequest(static_cast<uint8_t const *>(transfer.payload), transfer.payload_size);
+    if (!req.has_value())
+      return false;
+
+    uint16_t error = TError::OK;
+    size_t data_length = 0;
+
+    /* The file source writes straight into the response buffer. */
+    auto const rc = _file_source.read(req->path, req->offset, ReadCodec::MAX_DATA_LENGTH, ReadCodec::responseData(_rsp_buf.data()));
+    if (std::holds_alternative<FileSourceError>(rc))
+      error = toError(std::get<FileSourceError>(rc));
+    else
+      data_length = std::min(std::get<size_t>(rc), ReadCodec::MAX_DATA_LENGTH);
+
+    size_t const rsp_size = ReadCodec::encodeResponseHeader(_rsp_buf.data(), error, data_length);
+
+    if ((error == TError::OK) && (transfer.metadata.remote_node_id <= CANARD_NODE_ID_MAX))
+    {
+      _read_offset[transfer.metadata.remote_node_id] = req->offset + data_length;
+      _is_reading.set(transfer.metadata.remote_node_id);
+    }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    CanardTransferMetadata const transfer_metadata =
+    {
+      .priority       = transfer.metadata.priority,
+      .transfer_kind  = CanardTransferKindResponse,
+      .port_id        = transfer.metadata.port_id,
+      .remote_node_id = transfer.metadata.remote_node_id,
+      .transfer_id    = transfer.metadata.transfer_id,
+    };
+#pragma GCC diagnostic pop
+
+    return _node_hdl.enqueue_transfer(TX_TIMEOUT_usec,
+                                      &transfer_metadata,
+                                      rsp_size,
+                                      _rsp_buf.data());
+  }
+
+
+private:
+  Node & _node_hdl;
+  FileSource & _file_source;
+  std::array<uint8_t, ReadCodec::RESPONSE_BUFFER_SIZE> _rsp_buf;
+  std::array<uint64_t, CANARD_NODE_ID_MAX + 1> _read_offset;
+  std::bitset<CANARD_NODE_ID_MAX + 1> _is_reading;
+
+  [[nodiscard]] static uint16_t toError(FileSourceError const err)
+  {
+    switch (err)
+    {
+      case FileSourceError::Existence:   return TError::NOT_FOUND;
+      case FileSourceError::API:         return TError::INVALID_VALUE;
+      case FileSourceError::Access:      return TError::ACCESS_DENIED;
+      case FileSourceError::IsDirectory: return TError::IS_DIRECTORY;
+      case FileSourceError::IO:          return TError::IO_ERROR;
+      default:                           return TError::UNKNOWN_ERROR;
+    }
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
@@ -0,0 +1,60 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <memory>
+#include <optional>
+
+#include "../../ServiceServerBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class FileServerBase : public ServiceServerBase
+{
+public:
+  virtual ~FileServerBase() { }
+
+  /* The end of the most recent chunk successfully read
+   * by the given remote node, i.e. its download progress.
+   */
+  [[nodiscard]] virtual std::optional<uint64_t> read_offset(CanardNodeID const remote_node_id) const = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using FileServer = std::shared_ptr<impl::FileServerBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
@@ -0,0 +1,41 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+
+#include "FileSource.hpp"
+
+namespace cyphal::support::platform::file
+{
+
+namespace interface
+{
+
+/// A file sink receives the content of a downloaded file strictly in sequential order,
+/// e.g. a host file or the inactive firmware slot in the flash memory of a MCU.
+/// Writes are executed from within Node::spinSome() and should therefore be fast.
+class FileSink
+{
+public:
+    FileSink()                                   = default;
+    FileSink(const FileSink&)                    = delete;
+    FileSink(FileSink&&)                         = delete;
+    auto operator=(const FileSink&) -> FileSink& = delete;
+    auto operator=(FileSink&&) -> FileSink&      = delete;
+    virtual ~FileSink()                          = default;
+
+    /// Appends size bytes to the file. Either all or none of the data bytes are written.
+    [[nodiscard]] virtual auto write(const void* const data, const std::size_t size) -> std::optional<Error> = 0;
+};
+
+} /* interface */
+
+} /* cyphal::support::platform::file */
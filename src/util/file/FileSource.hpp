@@ -0,0 +1,55 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#include <variant>
+
+namespace cyphal::support::platform::file
+{
+
+enum class Error : std::uint8_t
+{
+    Existence,    ///< File does not exist.
+    API,          ///< Bad API invocation (e.g., malformed path).
+    Access,       ///< Access to the file is not permitted.
+    IsDirectory,  ///< The path refers to a directory.
+    IO,           ///< Device input/output error.
+    Internal,     ///< Internal failure of the file source.
+};
+
+namespace interface
+{
+
+/// A file source provides read-only access to files, e.g. a directory of the host filesystem
+/// or a firmware image stored in the flash memory of a MCU. Reads are expected to be fast
+/// (i.e. memory mapped or cached) as they are executed from within Node::spinSome().
+class FileSource
+{
+public:
+    FileSource()                                     = default;
+    FileSource(const FileSource&)                    = delete;
+    FileSource(FileSource&&)                         = delete;
+    auto operator=(const FileSource&) -> FileSource& = delete;
+    auto operator=(FileSource&&) -> FileSource&      = delete;
+    virtual ~FileSource()                            = default;
+
+    /// Copies up to size bytes of the file starting at offset into the buffer.
+    /// The return value is the number of bytes read into the buffer or the error.
+    /// Less than size bytes are only returned when the end of the file has been reached.
+    [[nodiscard]] virtual auto read(const std::string_view path,
+                                    const std::uint64_t offset,
+                                    const std::size_t size,
+                                    void* const data) -> std::variant<Error, std::size_t> = 0;
+};
+
+} /* interface */
+
+} /* cyphal::support::platform::file */
@@ -0,0 +1,135 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Encodes and decodes uavcan.file.Read (1.0 and 1.1 share the same
+ * wire layout) directly from/into transfer buffers. This avoids the
+ * heap allocated path and data arrays of the generated types and
+ * allows a file source to write the data directly into the response.
+ *
+ * Request:  uint40 offset | uint8 path length | uint8[<=255] path
+ * Response: uint16 error  | uint16 data length | uint8[<=256] data
+ */
+class ReadCodec
+{
+public:
+  static size_t constexpr MAX_PATH_LENGTH       = 255;
+  static size_t constexpr MAX_DATA_LENGTH       = 256;
+  static size_t constexpr REQUEST_HEADER_SIZE   = 6;
+  static size_t constexpr RESPONSE_HEADER_SIZE  = 4;
+  static size_t constexpr REQUEST_BUFFER_SIZE   = REQUEST_HEADER_SIZE  + MAX_PATH_LENGTH;
+  static size_t constexpr RESPONSE_BUFFER_SIZE  = RESPONSE_HEADER_SIZE + MAX_DATA_LENGTH;
+  static uint64_t constexpr MAX_OFFSET          = (1ULL << 40) - 1;
+
+  struct Request
+  {
+    uint64_t offset;
+    std::string_view path;
+  };
+
+  struct Response
+  {
+    uint16_t error;
+    uint8_t const * data;
+    size_t data_length;
+  };
+
+
+  /* The returned path refers to the memory of buf. */
+  [[nodiscard]] static std::optional<Request> decodeRequest(uint8_t const * const buf, size_t const size)
+  {
+    if (size < REQUEST_HEADER_SIZE)
+      return std::nullopt;
+
+    uint64_t offset = 0;
+    for (size_t i = 0; i < 5; i++)
+      offset |= static_cast<uint64_t>(buf[i]) << (8 * i);
+
+    /* Truncated paths are rejected rather than served partially. */
+    size_t const path_length = buf[5];
+    if ((REQUEST_HEADER_SIZE + path_length) > size)
+      return std::nullopt;
+
+    return Request{offset, std::string_view(reinterpret_cast<char const *>(buf + REQUEST_HEADER_SIZE), path_length)};
+  }
+
+  /* Returns the number of bytes of the encoded request, buf must be
+   * at least REQUEST_BUFFER_SIZE bytes large.
+   */
+  [[nodiscard]] static std::optional<size_t> encodeRequest(uint8_t * const buf, uint64_t const offset, std::string_view const path)
+  {
+    if ((offset > MAX_OFFSET) || (path.size() > MAX_PATH_LENGTH))
+      return std::nullopt;
+
+    for (size_t i = 0; i < 5; i++)
+      buf[i] = static_cast<uint8_t>(offset >> (8 * i));
+    buf[5] = static_cast<uint8_t>(path.size());
+    for (size_t i = 0; i < path.size(); i++)
+      buf[REQUEST_HEADER_SIZE + i] = static_cast<uint8_t>(path[i]);
+
+    return REQUEST_HEADER_SIZE + path.size();
+  }
+
+  /* The returned data refers to the memory of buf. */
+  [[nodiscard]] static std::optional<Response> decodeResponse(uint8_t const * const buf, size_t const size)
+  {
+    if (size < RESPONSE_HEADER_SIZE)
+      return std::nullopt;
+
+    uint16_t const error       = static_cast<uint16_t>(buf[0] | (buf[1] << 8));
+    size_t   const data_length = static_cast<size_t>(buf[2] | (buf[3] << 8));
+    if ((data_length > MAX_DATA_LENGTH) || ((RESPONSE_HEADER_SIZE + data_length) > size))
+      return std::nullopt;
+
+    return Response{error, buf + RESPONSE_HEADER_SIZE, data_length};
+  }
+
+  /* The data is expected to have already been written
+   * to responseData(buf), only the header is filled in.
+   * Returns the number of bytes of the encoded response.
+   */
+  static size_t encodeResponseHeader(uint8_t * const buf, uint16_t const error, size_t const data_length)
+  {
+    buf[0] = static_cast<uint8_t>(error);
+    buf[1] = static_cast<uint8_t>(error >> 8);
+    buf[2] = static_cast<uint8_t>(data_length);
+    buf[3] = static_cast<uint8_t>(data_length >> 8);
+    return RESPONSE_HEADER_SIZE + data_length;
+  }
+
+  [[nodiscard]] static uint8_t * responseData(uint8_t * const buf)
+  {
+    return buf + RESPONSE_HEADER_SIZE;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -0,0 +1,176 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+/* A single argument of a log record, captured by value when
+ * logging and only converted to text once it is published.
+ */
+struct LogArg
+{
+  enum class Type : uint8_t { Int, UInt, Double, String, Pointer };
+
+  Type type;
+  union
+  {
+    int64_t i;
+    uint64_t u;
+    double d;
+    char const * s;
+    void const * p;
+  };
+};
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+template<typename T>
+[[nodiscard]] inline LogArg toLogArg(T const arg)
+{
+  LogArg log_arg;
+  if constexpr (std::is_enum_v<T>) {
+    log_arg = toLogArg(static_cast<std::underlying_type_t<T>>(arg));
+  } else if constexpr (std::is_same_v<T, bool> || (std::is_integral_v<T> && std::is_signed_v<T>)) {
+    log_arg.type = LogArg::Type::Int;
+    log_arg.i = static_cast<int64_t>(arg);
+  } else if constexpr (std::is_integral_v<T>) {
+    log_arg.type = LogArg::Type::UInt;
+    log_arg.u = static_cast<uint64_t>(arg);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    log_arg.type = LogArg::Type::Double;
+    log_arg.d = static_cast<double>(arg);
+  } else if constexpr (std::is_same_v<std::decay_t<T>, char const *> || std::is_same_v<std::decay_t<T>, char *>) {
+    log_arg.type = LogArg::Type::String;
+    log_arg.s = arg;
+  } else {
+    static_assert(std::is_pointer_v<T>, "unsupported log argument type");
+    log_arg.type = LogArg::Type::Pointer;
+    log_arg.p = static_cast<void const *>(arg);
+  }
+  return log_arg;
+}
+
+/* printf-style formatting of captured arguments. Each conversion
+ * is handed to snprintf separately using the type the argument
+ * has been captured with, length modifiers of the format string
+ * are therefore ignored. Returns the length of the text which is
+ * truncated to buf_size - 1 characters and always terminated.
+ */
+inline size_t formatLog(char * const buf, size_t const buf_size, char const * fmt, LogArg const * const args, size_t const num_args)
+{
+  if (buf_size == 0)
+    return 0;
+
+  size_t len = 0;
+  size_t arg_idx = 0;
+
+  auto const append = [&](int const rc)
+  {
+    if (rc > 0)
+      len += std::min(static_cast<size_t>(rc), buf_size - 1 - len);
+  };
+
+  while (*fmt && (len < (buf_size - 1)))
+  {
+    if (*fmt != '%') {
+      buf[len++] = *fmt++;
+      continue;
+    }
+
+    /* Assemble the conversion specification. */
+    char spec[16] = {'%'};
+    size_t spec_len = 1;
+    fmt++;
+    while (*fmt && strchr("-+ #0123456789.", *fmt) && (spec_len < (sizeof(spec) - 4)))
+      spec[spec_len++] = *fmt++;
+    while (*fmt && strchr("hlLqjzt*", *fmt))
+      fmt++;
+    char const conversion = *fmt;
+    if (conversion)
+      fmt++;
+
+    if (conversion == '%') {
+      buf[len++] = '%';
+      continue;
+    }
+
+    if ((conversion == '\0') || !strchr("diuoxXcfFeEgGaAsp", conversion) || (arg_idx >= num_args))
+      continue;
+
+    LogArg const & arg = args[arg_idx++];
+    bool const is_int    = (arg.type == LogArg::Type::Int);
+    bool const is_double = (arg.type == LogArg::Type::Double);
+
+    if (strchr("di", conversion))
+    {
+      spec[spec_len++] = 'l'; spec[spec_len++] = 'l'; spec[spec_len++] = conversion;
+      long long const val = is_double ? static_cast<long long>(arg.d) : (is_int ? static_cast<long long>(arg.i) : static_cast<long long>(arg.u));
+      append(snprintf(buf + len, buf_size - len, spec, val));
+    }
+    else if (strchr("uoxX", conversion))
+    {
+      spec[spec_len++] = 'l'; spec[spec_len++] = 'l'; spec[spec_len++] = conversion;
+      unsigned long long const val = is_double ? static_cast<unsigned long long>(arg.d) : (is_int ? static_cast<unsigned long long>(arg.i) : static_cast<unsigned long long>(arg.u));
+      append(snprintf(buf + len, buf_size - len, spec, val));
+    }
+    else if (conversion == 'c')
+    {
+      spec[spec_len++] = conversion;
+      int const val = is_int ? static_cast<int>(arg.i) : static_cast<int>(arg.u);
+      append(snprintf(buf + len, buf_size - len, spec, val));
+    }
+    else if (strchr("fFeEgGaA", conversion))
+    {
+      spec[spec_len++] = conversion;
+      double const val = is_double ? arg.d : (is_int ? static_cast<double>(arg.i) : static_cast<double>(arg.u));
+      append(snprintf(buf + len, buf_size - len, spec, val));
+    }
+    else if (conversion == 's')
+    {
+      spec[spec_len++] = conversion;
+      char const * const val = ((arg.type == LogArg::Type::String) && arg.s) ? arg.s : "(?)";
+      append(snprintf(buf + len, buf_size - len, spec, val));
+    }
+    else if (conversion == 'p')
+    {
+      spec[spec_len++] = conversion;
+      append(snprintf(buf + len, buf_size - len, spec, arg.p));
+    }
+  }
+
+  buf[len] = '\0';
+  return len;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
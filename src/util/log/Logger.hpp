@@ -0,0 +1,161 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "LoggerBase.hpp"
+
+#include "../rate/TokenBucket.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/diagnostic.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class Logger final : public LoggerBase
+{
+public:
+  typedef uavcan::diagnostic::Record_1_1 TRecord;
+
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec            = 1000*1000UL;
+  static uint16_t          constexpr DEFAULT_RECORDS_PER_SECOND = 10;
+  static uint16_t          constexpr DEFAULT_BURST              = 10;
+  /* Bounds the time spent in a single spinSome(). */
+  static size_t            constexpr MAX_RECORDS_PER_UPDATE     = 4;
+
+
+  Logger(Node & node_hdl, cyphal::Node::MicrosFunc const micros_func)
+  : LoggerBase{micros_func}
+  , _node_hdl{node_hdl}
+  , _rate_limit{}
+  , _record_buf{}
+  , _transfer_id{0}
+  {
+    for (size_t s = 0; s < NUM_SEVERITIES; s++)
+      set_rate_limit(static_cast<Severity>(s), DEFAULT_RECORDS_PER_SECOND, DEFAULT_BURST);
+
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~Logger()
+  {
+    _node_hdl.remove_updatable(this);
+    _node_hdl.unpublish(TRecord::_traits_::FixedPortId);
+  }
+
+
+  virtual void set_rate_limit(Severity const severity, uint16_t const records_per_second, uint16_t const burst) override
+  {
+    _rate_limit[static_cast<size_t>(severity)].configure(records_per_second, burst, _micros_func());
+  }
+
+  virtual void update() override
+  {
+    auto const now = _micros_func();
+
+    for (size_t published = 0; published < MAX_RECORDS_PER_UPDATE; )
+    {
+      auto const entry = _queue.pop();
+      if (!entry.has_value())
+        return;
+
+      size_t const severity = static_cast<size_t>(entry->severity);
+
+      /* Records exceeding the rate limit are dropped rather than
+       * delayed, as a delayed record would only keep the bus busy
+       * for longer and delay the records following it.
+       */
+      if (!_rate_limit[severity].consume(now) || !publish(entry.value(), now)) {
+        _dropped[severity].fetch_add(1, std::memory_order_relaxed);
+        continue;
+      }
+
+      published++;
+    }
+  }
+
+
+private:
+  static size_t constexpr RECORD_HEADER_SIZE = 9;
+  static size_t constexpr MAX_TEXT_LENGTH    = 255;
+
+  Node & _node_hdl;
+  std::array<TokenBucket, NUM_SEVERITIES> _rate_limit;
+  std::array<uint8_t, RECORD_HEADER_SIZE + MAX_TEXT_LENGTH + 1> _record_buf;
+  CanardTransferID _transfer_id;
+
+
+  /* uavcan.diagnostic.Record.1.1 is serialized by hand, the text is
+   * formatted straight into the transfer buffer, avoiding the heap
+   * allocated text array of the generated type:
+   *
+   * truncated uint56 timestamp | uint3 severity | uint8 length | uint8[<=255] text
+   */
+  bool publish(Entry const & entry, CanardMicrosecond const now)
+  {
+    /* The timestamp is zero unless network time is available. */
+    uint64_t timestamp_usec = 0;
+    auto const synchronized_now = _node_hdl.synchronized_micros();
+    if (synchronized_now.has_value())
+      timestamp_usec = synchronized_now.value() - (now - entry.timestamp_usec);
+
+    for (size_t i = 0; i < 7; i++)
+      _record_buf[i] = static_cast<uint8_t>(timestamp_usec >> (8 * i));
+    _record_buf[7] = static_cast<uint8_t>(entry.severity) & 0x07;
+
+    /* One additional byte is required for the terminating null. */
+    size_t const text_length = formatLog(reinterpret_cast<char *>(_record_buf.data() + RECORD_HEADER_SIZE),
+                                         MAX_TEXT_LENGTH + 1,
+                                         entry.fmt,
+                                         entry.args.data(),
+                                         entry.num_args);
+    _record_buf[8] = static_cast<uint8_t>(text_length);
+
+    /* Records of lower severity are published at the lowest priority. */
+    CanardPriority const priority = (entry.severity >= Severity::Warning) ? CanardPrioritySlow : CanardPriorityOptional;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    CanardTransferMetadata const transfer_metadata =
+    {
+      .priority       = priority,
+      .transfer_kind  = CanardTransferKindMessage,
+      .port_id        = TRecord::_traits_::FixedPortId,
+      .remote_node_id = CANARD_NODE_ID_UNSET,
+      .transfer_id    = _transfer_id++,
+    };
+#pragma GCC diagnostic pop
+
+    return _node_hdl.enqueue_transfer(TX_TIMEOUT_usec,
+                                      &transfer_metadata,
+                                      RECORD_HEADER_SIZE + text_length,
+                                      _record_buf.data());
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
@@ -0,0 +1,143 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <functional>
+
+#include <libcanard/canard.h>
+
+#include "LogFormat.hpp"
+#include "../queue/MpscQueue.hpp"
+#include "../../UpdatableBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Logging only captures the format string, the arguments and a
+ * timestamp into a lock-free queue, which makes it safe to be used
+ * from time critical code and from other threads. Formatting and
+ * publishing as uavcan.diagnostic.Record happens from within
+ * Node::spinSome(). As the format string and string arguments are
+ * only accessed at that later point, they need to be string
+ * literals or otherwise remain valid.
+ */
+class LoggerBase : public UpdatableBase
+{
+public:
+  static size_t constexpr QUEUE_CAPACITY = 32;
+  static size_t constexpr MAX_ARGS       = 6;
+
+  enum class Severity : uint8_t
+  {
+    Trace    = 0,
+    Debug    = 1,
+    Info     = 2,
+    Notice   = 3,
+    Warning  = 4,
+    Error    = 5,
+    Critical = 6,
+    Alert    = 7,
+  };
+  static size_t constexpr NUM_SEVERITIES = 8;
+
+
+  LoggerBase(std::function<CanardMicrosecond()> const micros_func)
+  : _micros_func{micros_func}
+  , _queue{}
+  , _dropped{}
+  { }
+  virtual ~LoggerBase() { }
+
+
+  template<typename... Args>
+  bool log(Severity const severity, char const * const fmt, Args const... args)
+  {
+    static_assert(sizeof...(Args) <= MAX_ARGS, "too many log arguments");
+
+    Entry const entry{fmt, _micros_func(), severity, static_cast<uint8_t>(sizeof...(Args)), {toLogArg(args)...}};
+    if (!_queue.push(entry)) {
+      _dropped[static_cast<size_t>(severity)].fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    return true;
+  }
+
+  template<typename... Args> bool trace   (char const * const fmt, Args const... args) { return log(Severity::Trace,    fmt, args...); }
+  template<typename... Args> bool debug   (char const * const fmt, Args const... args) { return log(Severity::Debug,    fmt, args...); }
+  template<typename... Args> bool info    (char const * const fmt, Args const... args) { return log(Severity::Info,     fmt, args...); }
+  template<typename... Args> bool notice  (char const * const fmt, Args const... args) { return log(Severity::Notice,   fmt, args...); }
+  template<typename... Args> bool warning (char const * const fmt, Args const... args) { return log(Severity::Warning,  fmt, args...); }
+  template<typename... Args> bool error   (char const * const fmt, Args const... args) { return log(Severity::Error,    fmt, args...); }
+  template<typename... Args> bool critical(char const * const fmt, Args const... args) { return log(Severity::Critical, fmt, args...); }
+  template<typename... Args> bool alert   (char const * const fmt, Args const... args) { return log(Severity::Alert,    fmt, args...); }
+
+  /* The number of records of the given severity which were dropped
+   * either because the queue was full or due to rate limiting.
+   */
+  [[nodiscard]] uint32_t dropped(Severity const severity) const
+  {
+    return _dropped[static_cast<size_t>(severity)].load(std::memory_order_relaxed);
+  }
+
+  /* Limits the number of published records of the given severity to
+   * records_per_second on average while allowing bursts of up to
+   * burst records. A rate of zero suppresses the severity entirely.
+   */
+  virtual void set_rate_limit(Severity const severity, uint16_t const records_per_second, uint16_t const burst) = 0;
+
+
+protected:
+  struct Entry
+  {
+    char const * fmt;
+    CanardMicrosecond timestamp_usec;
+    Severity severity;
+    uint8_t num_args;
+    std::array<LogArg, MAX_ARGS> args;
+  };
+
+  std::function<CanardMicrosecond()> const _micros_func;
+  MpscQueue<Entry, QUEUE_CAPACITY> _queue;
+  std::array<std::atomic<uint32_t>, NUM_SEVERITIES> _dropped;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using Logger = std::shared_ptr<impl::LoggerBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
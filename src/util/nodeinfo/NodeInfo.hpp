@@ -55,6 +55,9 @@ public:
   {
     std::array<std::uint64_t, 1> const crc = {software_image_crc};
     std::copy(crc.cbegin(), crc.cend(), std::back_inserter(_node_info_rsp.software_image_crc));
+
+    if (_node_info_srv)
+      (void)_node_info_srv->update(_node_info_rsp);
   }
 
   NodeInfo(Node & node_hdl,
@@ -82,18 +85,16 @@ public:
     typedef uavcan::node::GetInfo::Request_1_0 TGetInfoRequest;
     typedef uavcan::node::GetInfo::Response_1_0 TGetInfoResponse;
 
-    _node_info_srv = node_hdl.create_service_server<TGetInfoRequest, TGetInfoResponse>(
+    /* The response never changes, hence it is serialized only once. */
+    _node_info_srv = node_hdl.create_const_response_service_server<TGetInfoRequest, TGetInfoResponse>(
       TGetInfoRequest::_traits_::FixedPortId,
       2*1000*1000UL,
-      [this](TGetInfoRequest const &) -> TGetInfoResponse
-      {
-        return _node_info_rsp;
-      });
+      _node_info_rsp);
   }
 
 
 private:
-  cyphal::ServiceServer _node_info_srv;
+  cyphal::ConstResponseServiceServer<uavcan::node::GetInfo::Response_1_0> _node_info_srv;
 };
 
 /**************************************************************************************
@@ -13,7 +13,7 @@
 
 #include <memory>
 
-#include "../../DSDL_Types.h"
+#include "../../DSDL_Types/uavcan/node.h"
 
 /**************************************************************************************
  * NAMESPACE
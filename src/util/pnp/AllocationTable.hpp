@@ -0,0 +1,194 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <array>
+#include <bitset>
+#include <optional>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Plug-and-play allocation table mapping unique-IDs to node-IDs.
+ * Lookups by unique-ID are O(1) via an open addressing hash index
+ * which is kept at a load factor of at most 50 %. Mock entries
+ * (node-IDs occupied by static nodes) carry an all-zero unique-ID
+ * and are not part of the hash index.
+ */
+class AllocationTable
+{
+public:
+  typedef std::array<uint8_t, 16> UniqueId;
+
+  static size_t constexpr NODE_ID_CAPACITY     = CANARD_NODE_ID_MAX + 1;
+  static CanardNodeID constexpr MAX_ALLOCATABLE_NODE_ID = CANARD_NODE_ID_MAX - 2; /* The two highest node-IDs are reserved for network maintenance tools. */
+  static size_t constexpr SERIALIZED_ENTRY_SIZE = 1 + std::tuple_size<UniqueId>::value;
+  static size_t constexpr SERIALIZED_MAX_SIZE   = NODE_ID_CAPACITY * SERIALIZED_ENTRY_SIZE;
+
+
+  AllocationTable()
+  : _used{}
+  , _unique_id{}
+  , _index{}
+  , _size{0}
+  {
+    _index.fill(CANARD_NODE_ID_UNSET);
+  }
+
+
+  [[nodiscard]] size_t size() const { return _size; }
+  [[nodiscard]] bool is_used(CanardNodeID const node_id) const { return (node_id < NODE_ID_CAPACITY) && _used.test(node_id); }
+
+  [[nodiscard]] std::optional<CanardNodeID> find(UniqueId const & unique_id) const
+  {
+    if (is_zero(unique_id))
+      return std::nullopt;
+
+    for (size_t slot = hash(unique_id); _index[slot] != CANARD_NODE_ID_UNSET; slot = next_slot(slot))
+      if (_unique_id[_index[slot]] == unique_id)
+        return _index[slot];
+
+    return std::nullopt;
+  }
+
+  /* Returns the node-ID already allocated for the unique-ID or allocates
+   * a new one, starting at the preferred node-ID and searching upwards,
+   * then downwards. Returns an empty optional if the table is full.
+   */
+  std::optional<CanardNodeID> allocate(UniqueId const & unique_id, CanardNodeID const preferred_node_id)
+  {
+    if (auto const node_id = find(unique_id); node_id.has_value())
+      return node_id;
+
+    CanardNodeID const start = std::min(preferred_node_id, MAX_ALLOCATABLE_NODE_ID);
+
+    for (size_t node_id = start; node_id <= MAX_ALLOCATABLE_NODE_ID; node_id++)
+      if (!_used.test(node_id)) {
+        insert(unique_id, static_cast<CanardNodeID>(node_id));
+        return static_cast<CanardNodeID>(node_id);
+      }
+
+    for (size_t node_id = start + 1; node_id-- > 0; )
+      if (!_used.test(node_id)) {
+        insert(unique_id, static_cast<CanardNodeID>(node_id));
+        return static_cast<CanardNodeID>(node_id);
+      }
+
+    return std::nullopt;
+  }
+
+  /* Adds an entry for a node-ID which is not yet used. Passing an all-zero
+   * unique-ID creates a mock entry for a statically configured node.
+   */
+  bool insert(UniqueId const & unique_id, CanardNodeID const node_id)
+  {
+    if ((node_id >= NODE_ID_CAPACITY) || _used.test(node_id))
+      return false;
+    if (find(unique_id).has_value())
+      return false;
+
+    _used.set(node_id);
+    _unique_id[node_id] = unique_id;
+    _size++;
+
+    if (!is_zero(unique_id))
+    {
+      size_t slot = hash(unique_id);
+      while (_index[slot] != CANARD_NODE_ID_UNSET)
+        slot = next_slot(slot);
+      _index[slot] = node_id;
+    }
+
+    return true;
+  }
+
+  /* Serialized format: a sequence of [node-ID, unique-ID[16]] entries. */
+  size_t serialize(uint8_t * buf, size_t const buf_size) const
+  {
+    size_t offset = 0;
+    for (size_t node_id = 0; node_id < NODE_ID_CAPACITY; node_id++)
+    {
+      if (!_used.test(node_id))
+        continue;
+      if ((offset + SERIALIZED_ENTRY_SIZE) > buf_size)
+        break;
+
+      buf[offset] = static_cast<uint8_t>(node_id);
+      std::copy(_unique_id[node_id].cbegin(), _unique_id[node_id].cend(), buf + offset + 1);
+      offset += SERIALIZED_ENTRY_SIZE;
+    }
+    return offset;
+  }
+
+  void deserialize(uint8_t const * buf, size_t const buf_size)
+  {
+    for (size_t offset = 0; (offset + SERIALIZED_ENTRY_SIZE) <= buf_size; offset += SERIALIZED_ENTRY_SIZE)
+    {
+      UniqueId unique_id{};
+      std::copy(buf + offset + 1, buf + offset + SERIALIZED_ENTRY_SIZE, unique_id.begin());
+      (void)insert(unique_id, buf[offset]);
+    }
+  }
+
+
+private:
+  static size_t constexpr INDEX_SIZE = 2 * NODE_ID_CAPACITY;
+  static_assert((INDEX_SIZE & (INDEX_SIZE - 1)) == 0, "INDEX_SIZE must be a power of two.");
+
+  std::bitset<NODE_ID_CAPACITY> _used;
+  std::array<UniqueId, NODE_ID_CAPACITY> _unique_id;
+  std::array<CanardNodeID, INDEX_SIZE> _index;
+  size_t _size;
+
+  static bool is_zero(UniqueId const & unique_id)
+  {
+    return std::all_of(unique_id.cbegin(), unique_id.cend(), [](uint8_t const b) { return b == 0; });
+  }
+
+  /* FNV-1a */
+  static size_t hash(UniqueId const & unique_id)
+  {
+    uint32_t h = 2166136261UL;
+    for (auto const b : unique_id)
+    {
+      h ^= b;
+      h *= 16777619UL;
+    }
+    return h & (INDEX_SIZE - 1);
+  }
+
+  static size_t next_slot(size_t const slot) { return (slot + 1) & (INDEX_SIZE - 1); }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
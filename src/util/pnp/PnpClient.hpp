@@ -0,0 +1,205 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "PnpClientBase.hpp"
+
+#include "crc64we.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/pnp.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class PnpClient final : public PnpClientBase
+{
+public:
+  typedef uavcan::pnp::NodeIDAllocationData_1_0 TAllocationData_1_0;
+  typedef uavcan::pnp::NodeIDAllocationData_2_0 TAllocationData_2_0;
+
+  PnpClient(Node & node_hdl,
+            cyphal::Node::MicrosFunc const micros_func,
+            std::array<uint8_t, 16> const & unique_id,
+            size_t const mtu_bytes)
+  : _node_hdl{node_hdl}
+  , _micros_func{micros_func}
+  , _unique_id{unique_id}
+  , _unique_id_hash{crc64we(unique_id.data(), unique_id.size()) & UNIQUE_ID_HASH_MASK}
+  , _prng_state{0}
+  , _next_request_usec{0}
+  , _is_allocated{false}
+  {
+    /* Seed the pseudo random number generator with both the unique-ID
+     * and the local time, so that identical nodes powered up at the
+     * same time do not end up requesting in lockstep.
+     */
+    _prng_state = (crc64we(unique_id.data(), unique_id.size()) ^ _micros_func()) | 1ULL;
+    restart_request_timer();
+
+    /* Allocation requests are sent as anonymous transfers. */
+    _node_hdl.setNodeId(CANARD_NODE_ID_UNSET);
+
+    /* Classic CAN can not carry the full unique-ID within a single
+     * anonymous frame, therefore its hashed down to 48 bit (v1).
+     */
+    if (mtu_bytes == CANARD_MTU_CAN_CLASSIC)
+    {
+      _alloc_1_0_pub = _node_hdl.create_publisher<TAllocationData_1_0>(TX_TIMEOUT_usec);
+      _alloc_1_0_sub = _node_hdl.create_subscription<TAllocationData_1_0>(
+        [this](TAllocationData_1_0 const & msg, TransferMetadata const & metadata)
+        {
+          onAllocationData_1_0_Received(msg, metadata);
+        });
+    }
+    else
+    {
+      _alloc_2_0_pub = _node_hdl.create_publisher<TAllocationData_2_0>(TX_TIMEOUT_usec);
+      _alloc_2_0_sub = _node_hdl.create_subscription<TAllocationData_2_0>(
+        [this](TAllocationData_2_0 const & msg, TransferMetadata const & metadata)
+        {
+          onAllocationData_2_0_Received(msg, metadata);
+        });
+    }
+
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~PnpClient()
+  {
+    _node_hdl.remove_updatable(this);
+  }
+
+
+  [[nodiscard]] virtual bool is_allocated() const override { return _is_allocated; }
+
+  virtual void update() override
+  {
+    if (_is_allocated)
+    {
+      /* Terminate the allocation protocol outside of the
+       * subscription callback which granted the node-ID.
+       */
+      _alloc_1_0_pub.reset();
+      _alloc_1_0_sub.reset();
+      _alloc_2_0_pub.reset();
+      _alloc_2_0_sub.reset();
+      return;
+    }
+
+    if (_micros_func() < _next_request_usec)
+      return;
+
+    restart_request_timer();
+
+    if (_alloc_1_0_pub)
+    {
+      TAllocationData_1_0 msg;
+      msg.unique_id_hash = _unique_id_hash;
+      _alloc_1_0_pub->publish(msg);
+    }
+
+    if (_alloc_2_0_pub)
+    {
+      TAllocationData_2_0 msg;
+      msg.node_id.value = CANARD_NODE_ID_MAX;
+      msg.unique_id = _unique_id;
+      _alloc_2_0_pub->publish(msg);
+    }
+  }
+
+
+private:
+  static uint64_t constexpr UNIQUE_ID_HASH_MASK = (1ULL << 48U) - 1ULL;
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec = 1 * 1000 * 1000UL;
+  static CanardMicrosecond constexpr MAX_REQUEST_PERIOD_usec = 1 * 1000 * 1000UL;
+
+  Node & _node_hdl;
+  cyphal::Node::MicrosFunc const _micros_func;
+  std::array<uint8_t, 16> const _unique_id;
+  uint64_t const _unique_id_hash;
+  uint64_t _prng_state;
+  CanardMicrosecond _next_request_usec;
+  bool _is_allocated;
+  cyphal::Publisher<TAllocationData_1_0> _alloc_1_0_pub;
+  cyphal::Subscription _alloc_1_0_sub;
+  cyphal::Publisher<TAllocationData_2_0> _alloc_2_0_pub;
+  cyphal::Subscription _alloc_2_0_sub;
+
+  /* xorshift64, sufficient for de-synchronizing the request timers. */
+  uint64_t next_random()
+  {
+    _prng_state ^= _prng_state << 13U;
+    _prng_state ^= _prng_state >> 7U;
+    _prng_state ^= _prng_state << 17U;
+    return _prng_state;
+  }
+
+  void restart_request_timer()
+  {
+    _next_request_usec = _micros_func() + (next_random() % (MAX_REQUEST_PERIOD_usec + 1));
+  }
+
+  void onAllocationData_1_0_Received(TAllocationData_1_0 const & msg, TransferMetadata const & metadata)
+  {
+    /* Any allocation message restarts the request timer (Rule C). */
+    restart_request_timer();
+
+    if (_is_allocated)
+      return;
+    if (metadata.remote_node_id > CANARD_NODE_ID_MAX)
+      return;
+    if ((msg.unique_id_hash & UNIQUE_ID_HASH_MASK) != _unique_id_hash)
+      return;
+    if (msg.allocated_node_id.empty() || (msg.allocated_node_id.front().value > CANARD_NODE_ID_MAX))
+      return;
+
+    _node_hdl.setNodeId(static_cast<CanardNodeID>(msg.allocated_node_id.front().value));
+    _is_allocated = true;
+  }
+
+  void onAllocationData_2_0_Received(TAllocationData_2_0 const & msg, TransferMetadata const & metadata)
+  {
+    /* Any allocation message restarts the request timer (Rule C). */
+    restart_request_timer();
+
+    if (_is_allocated)
+      return;
+    if (metadata.remote_node_id > CANARD_NODE_ID_MAX)
+      return;
+    if (msg.unique_id != _unique_id)
+      return;
+    if (msg.node_id.value > CANARD_NODE_ID_MAX)
+      return;
+
+    _node_hdl.setNodeId(static_cast<CanardNodeID>(msg.node_id.value));
+    _is_allocated = true;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
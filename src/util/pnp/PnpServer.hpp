@@ -0,0 +1,211 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "PnpServerBase.hpp"
+
+#include "AllocationTable.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/node.h"
+#include "../../DSDL_Types/uavcan/pnp.h"
+#include "../storage/KeyValueStorage.hpp"
+
+#if !defined(__GNUC__) || (__GNUC__ >= 11)
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class PnpServer final : public PnpServerBase
+{
+public:
+  typedef uavcan::pnp::NodeIDAllocationData_1_0 TAllocationData_1_0;
+  typedef uavcan::pnp::NodeIDAllocationData_2_0 TAllocationData_2_0;
+  typedef uavcan::node::Heartbeat_1_0 THeartbeat;
+  typedef support::platform::storage::interface::KeyValueStorage KeyValueStorage;
+
+  static constexpr char const * STORAGE_KEY = "cyphal.pnp.allocation_table";
+
+
+  PnpServer(Node & node_hdl, KeyValueStorage & kv_storage)
+  : _node_hdl{node_hdl}
+  , _kv_storage{kv_storage}
+  , _table{}
+  , _is_table_dirty{false}
+  {
+    load();
+
+    /* The allocator itself needs to be part of the allocation table. */
+    _is_table_dirty |= _table.insert(AllocationTable::UniqueId{}, _node_hdl.getNodeId());
+
+    /* Allocation requests of both versions are served from the same
+     * table, as nodes on CAN FD buses may choose to use v1 as well.
+     */
+    _alloc_1_0_pub = _node_hdl.create_publisher<TAllocationData_1_0>(TX_TIMEOUT_usec);
+    _alloc_1_0_sub = _node_hdl.create_subscription<TAllocationData_1_0>(
+      [this](TAllocationData_1_0 const & msg, TransferMetadata const & metadata)
+      {
+        onAllocationData_1_0_Received(msg, metadata);
+      });
+
+    _alloc_2_0_pub = _node_hdl.create_publisher<TAllocationData_2_0>(TX_TIMEOUT_usec);
+    _alloc_2_0_sub = _node_hdl.create_subscription<TAllocationData_2_0>(
+      [this](TAllocationData_2_0 const & msg, TransferMetadata const & metadata)
+      {
+        onAllocationData_2_0_Received(msg, metadata);
+      });
+
+    /* Node-IDs of statically configured nodes are
+     * recorded as mock entries upon first sight. Other
+     * Heartbeat subscriptions of the node, e.g. of the
+     * application, share the subject with this one, see
+     * SubjectDispatcher.
+     */
+    _heartbeat_sub = _node_hdl.create_subscription<THeartbeat>(
+      [this](THeartbeat const &, TransferMetadata const & metadata)
+      {
+        if (metadata.remote_node_id <= CANARD_NODE_ID_MAX)
+          _is_table_dirty |= _table.insert(AllocationTable::UniqueId{}, static_cast<CanardNodeID>(metadata.remote_node_id));
+      });
+
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~PnpServer()
+  {
+    _node_hdl.remove_updatable(this);
+  }
+
+
+  [[nodiscard]] virtual size_t allocation_count() const override { return _table.size(); }
+
+  virtual void update() override
+  {
+    /* Persisting the table is deferred and coalesced, so that
+     * a burst of allocation requests results in a single write.
+     */
+    if (!_is_table_dirty)
+      return;
+
+    /* The write is retried in the next cycle if it failed, otherwise
+     * a reboot could hand out node-IDs which are already in use.
+     */
+    if (save())
+      _is_table_dirty = false;
+  }
+
+
+private:
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec = 1 * 1000 * 1000UL;
+  static uint64_t constexpr UNIQUE_ID_HASH_MASK = (1ULL << 48U) - 1ULL;
+
+  Node & _node_hdl;
+  KeyValueStorage & _kv_storage;
+  AllocationTable _table;
+  bool _is_table_dirty;
+  cyphal::Publisher<TAllocationData_1_0> _alloc_1_0_pub;
+  cyphal::Subscription _alloc_1_0_sub;
+  cyphal::Publisher<TAllocationData_2_0> _alloc_2_0_pub;
+  cyphal::Subscription _alloc_2_0_sub;
+  cyphal::Subscription _heartbeat_sub;
+
+  void load()
+  {
+    std::array<uint8_t, AllocationTable::SERIALIZED_MAX_SIZE> buf;
+    auto const rc = _kv_storage.get(STORAGE_KEY, buf.size(), buf.data());
+    if (auto const * const size = std::get_if<std::size_t>(&rc))
+      _table.deserialize(buf.data(), *size);
+  }
+
+  [[nodiscard]] bool save()
+  {
+    std::array<uint8_t, AllocationTable::SERIALIZED_MAX_SIZE> buf;
+    size_t const size = _table.serialize(buf.data(), buf.size());
+    return !_kv_storage.put(STORAGE_KEY, size, buf.data()).has_value();
+  }
+
+  /* Requests received via v1 only contain the 48-bit hash of the
+   * unique-ID, which is zero-padded to obtain a pseudo unique-ID.
+   */
+  static AllocationTable::UniqueId toPseudoUniqueId(uint64_t const unique_id_hash)
+  {
+    AllocationTable::UniqueId unique_id{};
+    for (size_t i = 0; i < 6; i++)
+      unique_id[i] = static_cast<uint8_t>(unique_id_hash >> (8U * i));
+    return unique_id;
+  }
+
+  void onAllocationData_1_0_Received(TAllocationData_1_0 const & msg, TransferMetadata const & metadata)
+  {
+    /* Only anonymous transfers are requests, anything else
+     * is a response by another allocator.
+     */
+    if (metadata.remote_node_id <= CANARD_NODE_ID_MAX)
+      return;
+    if (!msg.allocated_node_id.empty())
+      return;
+
+    uint64_t const unique_id_hash = msg.unique_id_hash & UNIQUE_ID_HASH_MASK;
+    auto const node_id = allocate(toPseudoUniqueId(unique_id_hash), CANARD_NODE_ID_MAX);
+    if (!node_id.has_value())
+      return;
+
+    TAllocationData_1_0 rsp;
+    rsp.unique_id_hash = unique_id_hash;
+    rsp.allocated_node_id.push_back(uavcan::node::ID_1_0{node_id.value()});
+    _alloc_1_0_pub->publish(rsp);
+  }
+
+  void onAllocationData_2_0_Received(TAllocationData_2_0 const & msg, TransferMetadata const & metadata)
+  {
+    if (metadata.remote_node_id <= CANARD_NODE_ID_MAX)
+      return;
+
+    CanardNodeID const preferred_node_id = static_cast<CanardNodeID>(std::min<uint16_t>(msg.node_id.value, CANARD_NODE_ID_MAX));
+    auto const node_id = allocate(msg.unique_id, preferred_node_id);
+    if (!node_id.has_value())
+      return;
+
+    TAllocationData_2_0 rsp;
+    rsp.node_id.value = node_id.value();
+    rsp.unique_id = msg.unique_id;
+    _alloc_2_0_pub->publish(rsp);
+  }
+
+  std::optional<CanardNodeID> allocate(AllocationTable::UniqueId const & unique_id, CanardNodeID const preferred_node_id)
+  {
+    size_t const prev_size = _table.size();
+    auto const node_id = _table.allocate(unique_id, preferred_node_id);
+    _is_table_dirty |= (_table.size() != prev_size);
+    return node_id;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
+
+#endif /* !defined(__GNUC__) || (__GNUC__ >= 11) */
@@ -0,0 +1,50 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* CRC-64/WE as recommended by the Cyphal specification for
+ * hashing the unique-ID during plug-and-play node-ID allocation.
+ */
+inline uint64_t crc64we(uint8_t const * data, size_t const size)
+{
+  static uint64_t constexpr POLY = 0x42F0E1EBA9EA3693ULL;
+  static uint64_t constexpr MASK = 1ULL << 63U;
+
+  uint64_t crc = 0xFFFFFFFFFFFFFFFFULL;
+  for (size_t i = 0; i < size; i++)
+  {
+    crc ^= static_cast<uint64_t>(data[i]) << 56U;
+    for (size_t bit = 0; bit < 8; bit++)
+      crc = (crc & MASK) ? ((crc << 1U) ^ POLY) : (crc << 1U);
+  }
+  return crc ^ 0xFFFFFFFFFFFFFFFFULL;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
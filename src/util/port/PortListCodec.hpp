@@ -0,0 +1,134 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "PortSet.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Encodes uavcan.node.port.List.1.0 directly from the port sets into
+ * a buffer of MAX_SIZE bytes, i.e. without the generated message and
+ * its worst-case serialization buffer (both several kilobytes). The
+ * layout is the one decoded by PortListView:
+ *
+ * publishers (SubjectIDList) | subscribers (SubjectIDList) | clients (ServiceIDList) | servers (ServiceIDList)
+ *
+ * with each section preceded by its uint32 byte length.
+ */
+class PortListCodec
+{
+public:
+  static size_t constexpr DELIMITER_HEADER_SIZE  = 4;
+  static size_t constexpr SUBJECT_ID_CAPACITY    = 8192;
+  static size_t constexpr SERVICE_ID_CAPACITY    = 512;
+  static size_t constexpr MAX_SPARSE_LIST_SIZE   = 255;
+  static size_t constexpr SPARSE_LIST_ENTRY_SIZE = 2;
+  static uint8_t constexpr TAG_MASK              = 0;
+  static uint8_t constexpr TAG_SPARSE_LIST       = 1;
+
+  static size_t constexpr SUBJECT_ID_MASK_SIZE      = SUBJECT_ID_CAPACITY / 8;
+  static size_t constexpr SERVICE_ID_MASK_SIZE      = SERVICE_ID_CAPACITY / 8;
+  static size_t constexpr MAX_SUBJECT_ID_LIST_SIZE  = 1 + SUBJECT_ID_MASK_SIZE;
+  static size_t constexpr MAX_SIZE                  = 2 * (DELIMITER_HEADER_SIZE + MAX_SUBJECT_ID_LIST_SIZE)
+                                                    + 2 * (DELIMITER_HEADER_SIZE + SERVICE_ID_MASK_SIZE);
+
+
+  /* Returns the number of bytes of the encoded port
+   * list, buf must be at least MAX_SIZE bytes large.
+   */
+  static size_t encode(uint8_t * const buf,
+                       PortSet const & publishers,
+                       PortSet const & subscribers,
+                       PortSet const & clients,
+                       PortSet const & servers)
+  {
+    size_t offset = 0;
+    offset += encodeSubjectIDList(buf + offset, publishers);
+    offset += encodeSubjectIDList(buf + offset, subscribers);
+    offset += encodeServiceIDList(buf + offset, clients);
+    offset += encodeServiceIDList(buf + offset, servers);
+    return offset;
+  }
+
+
+private:
+  static void encodeDelimiterHeader(uint8_t * const buf, size_t const section_size)
+  {
+    for (size_t i = 0; i < DELIMITER_HEADER_SIZE; i++)
+      buf[i] = static_cast<uint8_t>(section_size >> (8 * i));
+  }
+
+  static void encodeMask(uint8_t * const mask, size_t const mask_size, PortSet const & ports)
+  {
+    memset(mask, 0, mask_size);
+    for (auto const & [port_id, ref_cnt] : ports)
+      if (port_id < (mask_size * 8))
+        mask[port_id / 8] |= static_cast<uint8_t>(1U << (port_id % 8));
+  }
+
+  /* Uses whichever encoding results in the smaller payload,
+   * the sparse list is always preferred for small port sets.
+   */
+  static size_t encodeSubjectIDList(uint8_t * const buf, PortSet const & ports)
+  {
+    uint8_t * const section = buf + DELIMITER_HEADER_SIZE;
+    size_t section_size = 0;
+
+    if ((ports.size() <= MAX_SPARSE_LIST_SIZE) && ((ports.size() * SPARSE_LIST_ENTRY_SIZE) < SUBJECT_ID_MASK_SIZE))
+    {
+      section[0] = TAG_SPARSE_LIST;
+      section[1] = static_cast<uint8_t>(ports.size());
+      section_size = 2;
+      for (auto const & [port_id, ref_cnt] : ports)
+      {
+        /* uint13 subject id | void3 */
+        section[section_size++] = static_cast<uint8_t>(port_id);
+        section[section_size++] = static_cast<uint8_t>((port_id >> 8) & 0x1F);
+      }
+    }
+    else
+    {
+      section[0] = TAG_MASK;
+      encodeMask(section + 1, SUBJECT_ID_MASK_SIZE, ports);
+      section_size = 1 + SUBJECT_ID_MASK_SIZE;
+    }
+
+    encodeDelimiterHeader(buf, section_size);
+    return DELIMITER_HEADER_SIZE + section_size;
+  }
+
+  static size_t encodeServiceIDList(uint8_t * const buf, PortSet const & ports)
+  {
+    encodeMask(buf + DELIMITER_HEADER_SIZE, SERVICE_ID_MASK_SIZE, ports);
+    encodeDelimiterHeader(buf, SERVICE_ID_MASK_SIZE);
+    return DELIMITER_HEADER_SIZE + SERVICE_ID_MASK_SIZE;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
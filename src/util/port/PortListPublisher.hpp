@@ -13,8 +13,13 @@
 
 #include "PortListPublisherBase.hpp"
 
+#include <array>
+
+#include "PortSet.hpp"
+#include "PortListCodec.hpp"
+
 #include "../../Node.hpp"
-#include "../../DSDL_Types.h"
+#include "../../DSDL_Types/uavcan/node.h"
 
 /**************************************************************************************
  * NAMESPACE
@@ -33,17 +38,26 @@ namespace impl
 class PortListPublisher final : public PortListPublisherBase
 {
 public:
+  typedef uavcan::node::port::List_1_0 TPortList;
+
   PortListPublisher(Node &node_hdl, cyphal::Node::MicrosFunc const micros_func)
-    : _pub{node_hdl.create_publisher<uavcan::node::port::List_1_0>(1 * 1000 * 1000UL /* = 1 sec in usecs. */)},
-      _micros_func{micros_func}, _prev_pub{0}, _list_msg{}
+    : _node_hdl{node_hdl}
+    , _micros_func{micros_func}
+    , _prev_pub{0}
+    , _transfer_id{0}
+    , _publishers{}
+    , _subscribers{}
+    , _servers{}
+    , _clients{}
+    , _list_msg_buf{}
+    , _list_msg_size{0}
+    , _is_list_msg_dirty{true}
   {
-    _list_msg.publishers.set_sparse_list();
-    _list_msg.subscribers.set_sparse_list();
-
-    /* This one won't be able automatically, as the object does not exist yet when
-     * this objects publisher is created.
+    /* The port list is published directly from the cached
+     * serialized payload and therefore does not own a
+     * publisher which could register itself.
      */
-    add_publisher(uavcan::node::port::List_1_0::_traits_::FixedPortId);
+    add_publisher(TPortList::_traits_::FixedPortId);
   }
 
   virtual ~PortListPublisher()
@@ -52,44 +66,99 @@ public:
   virtual void update() override
   {
     static CanardMicrosecond const MAX_PUBLICATION_PERIOD_us =
-      uavcan::node::port::List_1_0::MAX_PUBLICATION_PERIOD * 1000 * 1000UL;
+      TPortList::MAX_PUBLICATION_PERIOD * 1000 * 1000UL;
     auto const now = _micros_func();
     if ((now - _prev_pub) > MAX_PUBLICATION_PERIOD_us)
     {
       _prev_pub = now;
-      _pub->publish(_list_msg);
+
+      /* Only re-encode the port list if the set of
+       * ports has changed since the last publication.
+       */
+      if (_is_list_msg_dirty)
+      {
+        _list_msg_size = PortListCodec::encode(_list_msg_buf.data(), _publishers, _subscribers, _clients, _servers);
+        _is_list_msg_dirty = false;
+      }
+
+      publish_list_msg();
     }
   }
 
   virtual void add_publisher(CanardPortID const port_id) override
   {
-    auto sparse_list = _list_msg.publishers.get_sparse_list();
-    sparse_list.push_back(uavcan::node::port::SubjectID_1_0{port_id});
-    _list_msg.publishers.set_sparse_list(sparse_list);
+    _is_list_msg_dirty |= _publishers.add(port_id);
   }
 
   virtual void add_subscriber(CanardPortID const port_id) override
   {
-    auto sparse_list = _list_msg.subscribers.get_sparse_list();
-    sparse_list.push_back(uavcan::node::port::SubjectID_1_0{port_id});
-    _list_msg.subscribers.set_sparse_list(sparse_list);
+    _is_list_msg_dirty |= _subscribers.add(port_id);
   }
 
   virtual void add_service_server(CanardPortID const request_port_id) override
   {
-    _list_msg.servers.mask.set(request_port_id);
+    _is_list_msg_dirty |= _servers.add(request_port_id);
   }
 
   virtual void add_service_client(CanardPortID const response_port_id) override
   {
-    _list_msg.clients.mask.set(response_port_id);
+    _is_list_msg_dirty |= _clients.add(response_port_id);
+  }
+
+  virtual void remove_publisher(CanardPortID const port_id) override
+  {
+    _is_list_msg_dirty |= _publishers.remove(port_id);
+  }
+
+  virtual void remove_subscriber(CanardPortID const port_id) override
+  {
+    _is_list_msg_dirty |= _subscribers.remove(port_id);
+  }
+
+  virtual void remove_service_server(CanardPortID const request_port_id) override
+  {
+    _is_list_msg_dirty |= _servers.remove(request_port_id);
+  }
+
+  virtual void remove_service_client(CanardPortID const response_port_id) override
+  {
+    _is_list_msg_dirty |= _clients.remove(response_port_id);
   }
 
 private:
-  cyphal::Publisher<uavcan::node::port::List_1_0> _pub;
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec = 1 * 1000 * 1000UL; /* = 1 sec in usecs. */
+
+  Node & _node_hdl;
   cyphal::Node::MicrosFunc const _micros_func;
   CanardMicrosecond _prev_pub;
-  uavcan::node::port::List_1_0 _list_msg;
+  CanardTransferID _transfer_id;
+  PortSet _publishers, _subscribers, _servers, _clients;
+  std::array<uint8_t, PortListCodec::MAX_SIZE> _list_msg_buf;
+  size_t _list_msg_size;
+  bool _is_list_msg_dirty;
+
+  static_assert(PortListCodec::SUBJECT_ID_CAPACITY == uavcan::node::port::SubjectIDList_1_0::CAPACITY);
+  static_assert(PortListCodec::SERVICE_ID_CAPACITY == uavcan::node::port::ServiceIDList_1_0::CAPACITY);
+
+  bool publish_list_msg()
+  {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+    CanardTransferMetadata const transfer_metadata =
+    {
+      .priority       = CanardPriorityNominal,
+      .transfer_kind  = CanardTransferKindMessage,
+      .port_id        = TPortList::_traits_::FixedPortId,
+      .remote_node_id = CANARD_NODE_ID_UNSET,
+      .transfer_id    = _transfer_id++,
+    };
+#pragma GCC diagnostic pop
+
+    return _node_hdl.enqueue_transfer(TX_TIMEOUT_usec,
+                                      &transfer_metadata,
+                                      _list_msg_size,
+                                      _list_msg_buf.data());
+  }
 };
 
 /**************************************************************************************
@@ -44,6 +44,10 @@ public:
   virtual void add_subscriber(CanardPortID const port_id) = 0;
   virtual void add_service_server(CanardPortID const request_port_id) = 0;
   virtual void add_service_client(CanardPortID const response_port_id) = 0;
+  virtual void remove_publisher(CanardPortID const port_id) = 0;
+  virtual void remove_subscriber(CanardPortID const port_id) = 0;
+  virtual void remove_service_server(CanardPortID const request_port_id) = 0;
+  virtual void remove_service_client(CanardPortID const response_port_id) = 0;
 };
 
 /**************************************************************************************
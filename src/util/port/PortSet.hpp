@@ -0,0 +1,103 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdlib>
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Sorted flat set of port ids where each port id carries the
+ * number of endpoints currently using it. A port is part of the
+ * set for as long as at least one endpoint references it.
+ */
+class PortSet
+{
+public:
+  typedef std::pair<CanardPortID, size_t> Entry;
+  typedef std::vector<Entry>::const_iterator ConstIterator;
+
+  PortSet() : _ports{} { }
+
+  /* Returns true if the port was not part of the set before. */
+  bool add(CanardPortID const port_id)
+  {
+    auto iter = find(port_id);
+    if ((iter != _ports.end()) && (iter->first == port_id)) {
+      iter->second++;
+      return false;
+    }
+
+    _ports.insert(iter, Entry{port_id, 1});
+    return true;
+  }
+
+  /* Returns true if the last reference to the port was removed. */
+  bool remove(CanardPortID const port_id)
+  {
+    auto iter = find(port_id);
+    if ((iter == _ports.end()) || (iter->first != port_id))
+      return false;
+
+    if (--iter->second > 0)
+      return false;
+
+    _ports.erase(iter);
+    return true;
+  }
+
+  [[nodiscard]] bool contains(CanardPortID const port_id) const
+  {
+    return std::binary_search(_ports.cbegin(), _ports.cend(), Entry{port_id, 0}, compare);
+  }
+
+  [[nodiscard]] size_t size() const { return _ports.size(); }
+  [[nodiscard]] bool empty() const { return _ports.empty(); }
+
+  [[nodiscard]] ConstIterator begin() const { return _ports.cbegin(); }
+  [[nodiscard]] ConstIterator end() const { return _ports.cend(); }
+
+
+private:
+  std::vector<Entry> _ports;
+
+  static bool compare(Entry const & lhs, Entry const & rhs) { return lhs.first < rhs.first; }
+
+  std::vector<Entry>::iterator find(CanardPortID const port_id)
+  {
+    return std::lower_bound(_ports.begin(), _ports.end(), Entry{port_id, 0}, compare);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
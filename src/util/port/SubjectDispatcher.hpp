@@ -0,0 +1,115 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <vector>
+#include <algorithm>
+
+#include "../../SubscriptionBase.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* libcanard keeps a single subscription per port and replaces it on
+ * subscribing again. Once a second subscription is created for a
+ * subject (e.g. uavcan.node.Heartbeat by both the application and the
+ * PnpServer) the node subscribes this dispatcher in their place, which
+ * hands each transfer to all of them. Subscriptions removed while a
+ * transfer is dispatched are skipped and only erased afterwards.
+ */
+class SubjectDispatcher final : public SubscriptionBase
+{
+public:
+  SubjectDispatcher(CanardPortID const port_id)
+  : SubscriptionBase{CanardTransferKindMessage}
+  , _port_id{port_id}
+  , _subs{}
+  , _extent{0}
+  , _dispatch_depth{0}
+  { }
+
+
+  [[nodiscard]] CanardPortID port_id() const { return _port_id; }
+  /* The largest extent of all subscriptions. */
+  [[nodiscard]] size_t extent() const { return _extent; }
+  [[nodiscard]] bool is_dispatching() const { return _dispatch_depth > 0; }
+  [[nodiscard]] bool empty() const { return std::none_of(_subs.cbegin(), _subs.cend(), [](SubscriptionBase const * s) { return s != nullptr; }); }
+
+  [[nodiscard]] bool contains(SubscriptionBase const & sub) const
+  {
+    return std::find(_subs.cbegin(), _subs.cend(), &sub) != _subs.cend();
+  }
+
+  void add(SubscriptionBase & sub, size_t const extent)
+  {
+    if (!contains(sub))
+      _subs.push_back(&sub);
+    _extent = std::max(_extent, extent);
+  }
+
+  /* Returns false if the subscription was not dispatched to. */
+  bool remove(SubscriptionBase & sub)
+  {
+    auto iter = std::find(_subs.begin(), _subs.end(), &sub);
+    if (iter == _subs.end())
+      return false;
+
+    if (is_dispatching())
+      *iter = nullptr;
+    else
+      _subs.erase(iter);
+    return true;
+  }
+
+  virtual bool onTransferReceived(CanardRxTransfer const & transfer) override
+  {
+    _dispatch_depth++;
+
+    /* Subscriptions added from within a callback
+     * only receive the subsequent transfers.
+     */
+    bool is_received = false;
+    for (size_t i = 0, num_subs = _subs.size(); i < num_subs; i++)
+      if (_subs[i])
+        is_received |= _subs[i]->onTransferReceived(transfer);
+
+    if (--_dispatch_depth == 0)
+      _subs.erase(std::remove(_subs.begin(), _subs.end(), nullptr), _subs.end());
+
+    return is_received;
+  }
+
+
+private:
+  CanardPortID const _port_id;
+  std::vector<SubscriptionBase *> _subs;
+  size_t _extent;
+  size_t _dispatch_depth;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
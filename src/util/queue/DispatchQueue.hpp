@@ -0,0 +1,197 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+#include <libcanard/canard.h>
+
+#include "../../SubscriptionBase.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Holds completed transfers, whose payload has been allocated from
+ * the canard instance, until their subscription is invoked from
+ * within Node::spinSome(). Transfers are dispatched by priority and
+ * in order of reception within the same priority. Once the queue is
+ * full a transfer displaces the most recent transfer of a lower
+ * priority, if any, or is dropped otherwise.
+ */
+class DispatchQueue
+{
+public:
+  DispatchQueue(CanardInstance & canard_hdl, size_t const capacity)
+  : _canard_hdl{canard_hdl}
+  , _capacity{std::max<size_t>(capacity, 1)}
+  , _items{}
+  , _sequence{0}
+  , _dropped{0}
+  {
+    _items.reserve(_capacity);
+  }
+  ~DispatchQueue()
+  {
+    for (auto & item : _items)
+      release(item.transfer);
+  }
+  DispatchQueue(DispatchQueue const &) = delete;
+  DispatchQueue(DispatchQueue &&) = delete;
+  DispatchQueue &operator=(DispatchQueue const &) = delete;
+  DispatchQueue &operator=(DispatchQueue &&) = delete;
+
+
+  /* Takes over the ownership of the payload of the transfer. */
+  void push(SubscriptionBase & sub, CanardRxTransfer const & transfer)
+  {
+    if (!makeRoom(transfer.metadata.priority)) {
+      release(transfer);
+      return;
+    }
+
+    _items.push_back(Item{&sub, transfer, _sequence++});
+  }
+
+  /* Copies the payload, which remains owned by the caller. */
+  void pushCopy(SubscriptionBase & sub, CanardRxTransfer const & transfer)
+  {
+    CanardRxTransfer copy = transfer;
+    copy.payload = (transfer.payload_size > 0) ? _canard_hdl.memory_allocate(&_canard_hdl, transfer.payload_size) : nullptr;
+    if ((transfer.payload_size > 0) && !copy.payload) {
+      _dropped++;
+      return;
+    }
+    if (transfer.payload_size > 0)
+      std::memcpy(copy.payload, transfer.payload, transfer.payload_size);
+
+    push(sub, copy);
+  }
+
+  /* Dispatches pending transfers until budget_usec have elapsed,
+   * but at least one. Returns the number of dispatched transfers.
+   */
+  size_t process(std::function<CanardMicrosecond()> const & micros_func, CanardMicrosecond const budget_usec)
+  {
+    CanardMicrosecond const start_usec = micros_func();
+    size_t num_dispatched = 0;
+
+    while (!_items.empty())
+    {
+      if ((num_dispatched > 0) && ((micros_func() - start_usec) >= budget_usec))
+        break;
+
+      /* The item is removed before invoking the subscription, which
+       * may destroy other subscriptions and thereby discard() items.
+       */
+      auto next = std::min_element(_items.begin(), _items.end(), isDispatchedBefore);
+      Item const item = *next;
+      _items.erase(next);
+
+      (void)item.sub->onTransferReceived(item.transfer);
+      release(item.transfer);
+      num_dispatched++;
+    }
+
+    return num_dispatched;
+  }
+
+  /* Discards all pending transfers of a port, e.g. once it is unsubscribed. */
+  void discard(CanardTransferKind const transfer_kind, CanardPortID const port_id)
+  {
+    auto const is_discarded = [transfer_kind, port_id](Item const & item)
+                              {
+                                return (item.transfer.metadata.transfer_kind == transfer_kind) &&
+                                       (item.transfer.metadata.port_id       == port_id);
+                              };
+    for (auto & item : _items)
+      if (is_discarded(item))
+        release(item.transfer);
+    _items.erase(std::remove_if(_items.begin(), _items.end(), is_discarded), _items.end());
+  }
+
+  /* Discards all pending transfers of a subscription, e.g. once it is destroyed. */
+  void discard(SubscriptionBase const & sub)
+  {
+    auto const is_discarded = [&sub](Item const & item) { return item.sub == &sub; };
+    for (auto & item : _items)
+      if (is_discarded(item))
+        release(item.transfer);
+    _items.erase(std::remove_if(_items.begin(), _items.end(), is_discarded), _items.end());
+  }
+
+  [[nodiscard]] size_t size() const { return _items.size(); }
+  [[nodiscard]] uint32_t dropped() const { return _dropped; }
+
+
+private:
+  struct Item
+  {
+    SubscriptionBase * sub;
+    CanardRxTransfer transfer;
+    uint32_t sequence;
+  };
+
+  CanardInstance & _canard_hdl;
+  size_t const _capacity;
+  std::vector<Item> _items;
+  uint32_t _sequence;
+  uint32_t _dropped;
+
+
+  static bool isDispatchedBefore(Item const & lhs, Item const & rhs)
+  {
+    if (lhs.transfer.metadata.priority != rhs.transfer.metadata.priority)
+      return lhs.transfer.metadata.priority < rhs.transfer.metadata.priority;
+    /* Wraparound safe comparison of the sequence numbers. */
+    return static_cast<int32_t>(lhs.sequence - rhs.sequence) < 0;
+  }
+
+  bool makeRoom(CanardPriority const priority)
+  {
+    if (_items.size() < _capacity)
+      return true;
+
+    _dropped++;
+
+    auto last = std::max_element(_items.begin(), _items.end(), isDispatchedBefore);
+    if (last->transfer.metadata.priority <= priority)
+      return false;
+
+    release(last->transfer);
+    _items.erase(last);
+    return true;
+  }
+
+  void release(CanardRxTransfer const & transfer)
+  {
+    if (transfer.payload)
+      _canard_hdl.memory_free(&_canard_hdl, transfer.payload);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -0,0 +1,147 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Bounded lock-free queue which may be pushed to from multiple
+ * threads (or interrupts) while a single thread pops from it.
+ * Each cell carries a sequence number signalling whether it is
+ * free to be written or ready to be read, a producer claims a cell
+ * by advancing the shared enqueue position via compare-and-swap.
+ */
+template<typename T, size_t CAPACITY>
+class MpscQueue
+{
+  static_assert((CAPACITY >= 2) && ((CAPACITY & (CAPACITY - 1)) == 0), "CAPACITY must be a power of two");
+
+public:
+  MpscQueue()
+  : _enqueue_pos{0}
+  , _dequeue_pos{0}
+  {
+    for (size_t i = 0; i < CAPACITY; i++)
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  MpscQueue(MpscQueue const &) = delete;
+  MpscQueue(MpscQueue &&) = delete;
+  MpscQueue &operator=(MpscQueue const &) = delete;
+  MpscQueue &operator=(MpscQueue &&) = delete;
+
+
+  /* Returns false if the queue is full. */
+  [[nodiscard]] bool push(T const & data)
+  {
+    return push_in_place([&data](T & cell_data, size_t const) { cell_data = data; });
+  }
+
+  /* Like push(), but lets write(data, index) fill in the claimed
+   * cell in place. The index (< CAPACITY) identifies the cell, e.g.
+   * for storing further data in a buffer per cell.
+   */
+  template <typename Write>
+  [[nodiscard]] bool push_in_place(Write && write)
+  {
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Cell & cell = _cells[pos & (CAPACITY - 1)];
+      size_t const seq = cell.sequence.load(std::memory_order_acquire);
+      intptr_t const diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+      if (diff == 0)
+      {
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          write(cell.data, pos & (CAPACITY - 1));
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0)
+        return false;
+      else
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+    }
+  }
+
+  /* Must only be called from the single consumer. */
+  [[nodiscard]] std::optional<T> pop()
+  {
+    std::optional<T> data;
+    (void)pop_in_place([&data](T & cell_data, size_t const) { data = std::move(cell_data); });
+    return data;
+  }
+
+  /* Must only be called from the single consumer. Lets read(data, index)
+   * access the next cell in place, the cell is only handed back to the
+   * producers once read() has returned. Returns false if the queue is empty.
+   */
+  template <typename Read>
+  bool pop_in_place(Read && read)
+  {
+    size_t const pos = _dequeue_pos.load(std::memory_order_relaxed);
+    Cell & cell = _cells[pos & (CAPACITY - 1)];
+    size_t const seq = cell.sequence.load(std::memory_order_acquire);
+
+    /* The next cell has not yet been completely written. */
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0)
+      return false;
+
+    read(cell.data, pos & (CAPACITY - 1));
+    _dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+    cell.sequence.store(pos + CAPACITY, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    size_t const pos = _dequeue_pos.load(std::memory_order_relaxed);
+    size_t const seq = _cells[pos & (CAPACITY - 1)].sequence.load(std::memory_order_acquire);
+    return (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0);
+  }
+
+  [[nodiscard]] static constexpr size_t capacity() { return CAPACITY; }
+
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+  std::array<Cell, CAPACITY> _cells;
+  std::atomic<size_t> _enqueue_pos;
+  std::atomic<size_t> _dequeue_pos;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
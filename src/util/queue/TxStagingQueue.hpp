@@ -0,0 +1,119 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <vector>
+#include <cstring>
+#include <utility>
+
+#include <libcanard/canard.h>
+
+#include "MpscQueue.hpp"
+#include "../../PublisherBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Serialized outbound transfers pushed from any number of threads
+ * and drained by the single thread calling Node::spinSome(). The
+ * payload is copied into a fixed buffer belonging to the queue cell
+ * claimed by the pushing thread, all buffers are allocated once on
+ * construction, so that producers only ever contend on the enqueue
+ * position of the lock-free queue.
+ */
+class TxStagingQueue
+{
+public:
+  static size_t constexpr CAPACITY                 = 64;
+  static size_t constexpr DEFAULT_MAX_PAYLOAD_SIZE = 512;
+
+  struct Transfer
+  {
+    CanardMicrosecond tx_deadline_usec;
+    CanardTransferMetadata metadata;
+    size_t payload_size;
+    uint8_t const * payload;
+    OnTransferTransmittedCb on_transmitted_cb;
+  };
+
+
+  TxStagingQueue(size_t const max_payload_size = DEFAULT_MAX_PAYLOAD_SIZE)
+  : _max_payload_size{max_payload_size}
+  , _payload_buf(CAPACITY * max_payload_size)
+  , _queue{}
+  { }
+  TxStagingQueue(TxStagingQueue const &) = delete;
+  TxStagingQueue(TxStagingQueue &&) = delete;
+  TxStagingQueue &operator=(TxStagingQueue const &) = delete;
+  TxStagingQueue &operator=(TxStagingQueue &&) = delete;
+
+
+  [[nodiscard]] size_t max_payload_size() const { return _max_payload_size; }
+
+  /* Returns false if the queue is full or the payload
+   * exceeds max_payload_size().
+   */
+  [[nodiscard]] bool push(CanardMicrosecond const tx_deadline_usec,
+                          CanardTransferMetadata const & metadata,
+                          size_t const payload_size,
+                          uint8_t const * const payload,
+                          OnTransferTransmittedCb const & on_transmitted_cb)
+  {
+    if (payload_size > _max_payload_size)
+      return false;
+
+    return _queue.push_in_place([&](Transfer & transfer, size_t const index)
+                                {
+                                  uint8_t * const payload_copy = _payload_buf.data() + index * _max_payload_size;
+                                  if (payload_size > 0)
+                                    std::memcpy(payload_copy, payload, payload_size);
+                                  transfer = Transfer{tx_deadline_usec, metadata, payload_size, payload_copy, on_transmitted_cb};
+                                });
+  }
+
+  /* Must only be called from the single consumer. Hands all staged
+   * transfers to on_transfer in the order they were pushed, the
+   * payload is only valid for the duration of the call.
+   */
+  template <typename OnTransfer>
+  size_t drain(OnTransfer && on_transfer)
+  {
+    size_t num_transfers = 0;
+    while (_queue.pop_in_place([&on_transfer](Transfer & staged_transfer, size_t const)
+                               {
+                                 Transfer const transfer = std::move(staged_transfer);
+                                 on_transfer(transfer);
+                               }))
+      num_transfers++;
+    return num_transfers;
+  }
+
+
+private:
+  size_t const _max_payload_size;
+  std::vector<uint8_t> _payload_buf;
+  MpscQueue<Transfer, CAPACITY> _queue;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
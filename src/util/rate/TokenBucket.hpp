@@ -0,0 +1,80 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Limits events to a rate on average while allowing bursts. The
+ * credit is kept in microseconds, each event costs one period.
+ */
+class TokenBucket
+{
+public:
+  TokenBucket()
+  : _period_usec{0}
+  , _max_credit_usec{0}
+  , _credit_usec{0}
+  , _prev_usec{0}
+  { }
+
+
+  /* A rate of zero suppresses all events. */
+  void configure(uint32_t const events_per_second, uint32_t const burst, CanardMicrosecond const now)
+  {
+    _period_usec     = (events_per_second > 0) ? (1000*1000UL / events_per_second) : 0;
+    _max_credit_usec = _period_usec * std::max<uint32_t>(burst, 1);
+    _credit_usec     = _max_credit_usec;
+    _prev_usec       = now;
+  }
+
+  [[nodiscard]] bool consume(CanardMicrosecond const now)
+  {
+    if (_period_usec == 0)
+      return false;
+
+    _credit_usec = std::min(_max_credit_usec, _credit_usec + (now - _prev_usec));
+    _prev_usec = now;
+
+    if (_credit_usec < _period_usec)
+      return false;
+
+    _credit_usec -= _period_usec;
+    return true;
+  }
+
+
+private:
+  CanardMicrosecond _period_usec;
+  CanardMicrosecond _max_credit_usec;
+  CanardMicrosecond _credit_usec;
+  CanardMicrosecond _prev_usec;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -12,7 +12,7 @@
  **************************************************************************************/
 
 #include "../../Node.hpp"
-#include "../../DSDL_Types.h"
+#include "../../DSDL_Types/uavcan/_register.h"
 
 #include "registry_impl.hpp"
 
@@ -43,17 +43,17 @@ public:
     _reg_list_srv = node_hdl.create_service_server<TListRequest, TListResponse>(
       TListRequest::_traits_::FixedPortId,
       2 * 1000 * 1000UL,
-      [this](TListRequest const &req)
+      [this](TListRequest const &req, TListResponse &rsp)
       {
-        return onList_1_0_Request_Received(req);
+        onList_1_0_Request_Received(req, rsp);
       });
 
     _reg_access_srv = node_hdl.create_service_server<TAccessRequest, TAccessResponse>(
       TAccessRequest::_traits_::FixedPortId,
       2 * 1000 * 1000UL,
-      [this](TAccessRequest const &req)
+      [this](TAccessRequest const &req, TAccessResponse &rsp)
       {
-        return onAccess_1_0_Request_Received(req);
+        onAccess_1_0_Request_Received(req, rsp);
       });
   }
 
@@ -64,24 +64,20 @@ private:
   typedef uavcan::_register::List::Response_1_0 TListResponse;
   cyphal::ServiceServer _reg_list_srv;
 
-  TListResponse onList_1_0_Request_Received(TListRequest const &req)
+  void onList_1_0_Request_Received(TListRequest const &req, TListResponse &rsp)
   {
-    TListResponse rsp{};
-
     if (req.index < size())
     {
       auto const name = index(req.index);
       std::copy(name.name.cbegin(), name.name.cend(), std::back_inserter(rsp.name.name));
     }
-
-    return rsp;
   }
 
   typedef uavcan::_register::Access::Request_1_0 TAccessRequest;
   typedef uavcan::_register::Access::Response_1_0 TAccessResponse;
   cyphal::ServiceServer _reg_access_srv;
 
-  TAccessResponse onAccess_1_0_Request_Received(TAccessRequest const &req)
+  void onAccess_1_0_Request_Received(TAccessRequest const &req, TAccessResponse &rsp)
   {
     auto const req_name = std::string_view(reinterpret_cast<const char *>(req.name.name.data()),
                                            req.name.name.size());
@@ -92,21 +88,20 @@ private:
     if (!req.value.is_empty())
       (void) set(req_name, req.value);
 
-    /* Return an empty response, if the repository with the desired
-     * name can not be found.
+    /* Respond with an empty response, if the repository with the
+     * desired name can not be found.
      */
     auto reg_with_metadata = get(req_name);
     if (!reg_with_metadata.has_value())
-      return TAccessResponse{};
+      return;
 
-    /* Prepare the response for this access request. */
-    return TAccessResponse
-      {
-        _micros(),
-        reg_with_metadata.value().flags.mutable_,
-        reg_with_metadata.value().flags.persistent,
-        reg_with_metadata.value().value
-      };
+    /* Prepare the response for this access request, the value
+     * is moved rather than copied into the response.
+     */
+    rsp.timestamp.microsecond = _micros();
+    rsp._mutable              = reg_with_metadata.value().flags.mutable_;
+    rsp.persistent            = reg_with_metadata.value().flags.persistent;
+    rsp.value                 = std::move(reg_with_metadata.value().value);
   }
 };
 
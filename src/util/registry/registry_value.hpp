@@ -11,11 +11,13 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <string_view>
 
-#include "../../DSDL_Types.h"
+#include "../../DSDL_Types/uavcan/_register.h"
+#include "../../DSDL_Types/uavcan/primitive.h"
 
 #if !defined(__GNUC__) || (__GNUC__ >= 11)
 
@@ -0,0 +1,109 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+
+#include <optional>
+#include <algorithm>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Maps local time onto a reference time base given pairs of
+ * (local, reference) timestamps. The phase is re-anchored with
+ * every sample while the rate ratio between both clocks is
+ * low-pass filtered in order to bridge the time between samples.
+ */
+class DriftCompensatedClock
+{
+public:
+  static int64_t constexpr MAX_PHASE_ERROR_usec = 10 * 1000L;
+  static double  constexpr MAX_RATE_ERROR       = 1000.0e-6; /* 1000 ppm */
+  static double  constexpr RATE_FILTER_GAIN     = 0.125;
+
+
+  DriftCompensatedClock()
+  : _num_samples{0}
+  , _anchor_local_usec{0}
+  , _anchor_reference_usec{0}
+  , _rate{1.0}
+  { }
+
+
+  void reset()
+  {
+    _num_samples = 0;
+    _rate = 1.0;
+  }
+
+  void update(uint64_t const local_usec, uint64_t const reference_usec)
+  {
+    if ((_num_samples > 0) && (local_usec > _anchor_local_usec))
+    {
+      int64_t const phase_error = static_cast<int64_t>(reference_usec - convert(local_usec));
+
+      /* Large phase errors indicate a leap of the reference
+       * clock (i.e. a new master), so start over.
+       */
+      if ((phase_error > MAX_PHASE_ERROR_usec) || (phase_error < -MAX_PHASE_ERROR_usec))
+        reset();
+      else
+      {
+        double const measured_rate = static_cast<double>(reference_usec - _anchor_reference_usec) /
+                                     static_cast<double>(local_usec - _anchor_local_usec);
+        double const filter_gain = (_num_samples == 1) ? 1.0 : RATE_FILTER_GAIN;
+        _rate += filter_gain * (measured_rate - _rate);
+        _rate  = std::clamp(_rate, 1.0 - MAX_RATE_ERROR, 1.0 + MAX_RATE_ERROR);
+      }
+    }
+
+    _anchor_local_usec = local_usec;
+    _anchor_reference_usec = reference_usec;
+    if (_num_samples < 2)
+      _num_samples++;
+  }
+
+  [[nodiscard]] bool is_valid() const { return _num_samples > 0; }
+  [[nodiscard]] double rate() const { return _rate; }
+
+  [[nodiscard]] uint64_t convert(uint64_t const local_usec) const
+  {
+    int64_t const local_delta = static_cast<int64_t>(local_usec - _anchor_local_usec);
+    return _anchor_reference_usec + static_cast<int64_t>(static_cast<double>(local_delta) * _rate);
+  }
+
+
+private:
+  uint8_t _num_samples;
+  uint64_t _anchor_local_usec;
+  uint64_t _anchor_reference_usec;
+  double _rate;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
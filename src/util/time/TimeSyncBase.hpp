@@ -0,0 +1,65 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <memory>
+#include <optional>
+
+#include <libcanard/canard.h>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class TimeSyncBase
+{
+public:
+  TimeSyncBase() = default;
+  virtual ~TimeSyncBase() { }
+  TimeSyncBase(TimeSyncBase const &) = delete;
+  TimeSyncBase(TimeSyncBase &&) = delete;
+  TimeSyncBase &operator=(TimeSyncBase const &) = delete;
+  TimeSyncBase &operator=(TimeSyncBase &&) = delete;
+
+  /* Converts a local timestamp into the network time base, returns
+   * an empty optional as long as no time reference is available.
+   */
+  [[nodiscard]] virtual std::optional<CanardMicrosecond> synchronized_micros(CanardMicrosecond const local_usec) const = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using TimeSync = std::shared_ptr<impl::TimeSyncBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
@@ -0,0 +1,115 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "TimeSyncBase.hpp"
+
+#include "../../UpdatableBase.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/time.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class TimeSyncMaster final : public TimeSyncBase, public UpdatableBase
+{
+public:
+  typedef uavcan::time::Synchronization_1_0 TSynchronization;
+
+  TimeSyncMaster(Node & node_hdl, cyphal::Node::MicrosFunc const micros_func)
+  : _node_hdl{node_hdl}
+  , _micros_func{micros_func}
+  , _pub{node_hdl.create_publisher<TSynchronization>(TX_TIMEOUT_usec)}
+  , _prev_pub{0}
+  , _prev_tx_timestamp_usec{std::make_shared<CanardMicrosecond>(0)}
+  {
+    _node_hdl.add_updatable(this);
+    _node_hdl.register_time_sync(this);
+  }
+
+  virtual ~TimeSyncMaster()
+  {
+    _node_hdl.unregister_time_sync(this);
+    _node_hdl.remove_updatable(this);
+  }
+
+
+  /* The master defines the network time base. */
+  [[nodiscard]] virtual std::optional<CanardMicrosecond> synchronized_micros(CanardMicrosecond const local_usec) const override
+  {
+    return local_usec;
+  }
+
+  virtual void update() override
+  {
+    static CanardMicrosecond const MAX_PUBLICATION_PERIOD_us =
+      TSynchronization::MAX_PUBLICATION_PERIOD * 1000 * 1000UL;
+    auto const now = _micros_func();
+    if ((now - _prev_pub) < MAX_PUBLICATION_PERIOD_us)
+      return;
+
+    _prev_pub = now;
+
+    /* Each message carries the transmission timestamp of its
+     * predecessor, a value of zero signals its not available.
+     */
+    TSynchronization msg;
+    msg.previous_transmission_timestamp_microsecond = *_prev_tx_timestamp_usec;
+    *_prev_tx_timestamp_usec = 0;
+
+    /* Only the actual transmission timestamp, reported by the
+     * driver via Node::onCanFrameTransmitted(), is published with
+     * the next message. The time of handing the transfer over for
+     * transmission is not a substitute, as it misses the time the
+     * frame spends within the transmit queue and in arbitration.
+     * The callback only holds a weak reference as it may outlive
+     * this object.
+     */
+    std::weak_ptr<CanardMicrosecond> const weak_prev_tx_timestamp_usec = _prev_tx_timestamp_usec;
+    auto const on_transmitted = [weak_prev_tx_timestamp_usec](CanardMicrosecond const tx_timestamp_usec)
+    {
+      if (auto prev_tx_timestamp_usec = weak_prev_tx_timestamp_usec.lock())
+        *prev_tx_timestamp_usec = tx_timestamp_usec;
+    };
+
+    _pub->publish(msg, on_transmitted);
+  }
+
+
+private:
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec = 100 * 1000UL;
+
+  Node & _node_hdl;
+  cyphal::Node::MicrosFunc const _micros_func;
+  cyphal::Publisher<TSynchronization> _pub;
+  CanardMicrosecond _prev_pub;
+  std::shared_ptr<CanardMicrosecond> _prev_tx_timestamp_usec;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
@@ -0,0 +1,136 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "TimeSyncBase.hpp"
+
+#include "DriftCompensatedClock.hpp"
+
+#include "../../Node.hpp"
+#include "../../DSDL_Types/uavcan/time.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class TimeSyncSlave final : public TimeSyncBase
+{
+public:
+  typedef uavcan::time::Synchronization_1_0 TSynchronization;
+
+  TimeSyncSlave(Node & node_hdl)
+  : _node_hdl{node_hdl}
+  , _master_node_id{CANARD_NODE_ID_UNSET}
+  , _prev_rx_timestamp_usec{0}
+  , _prev_transfer_id{0}
+  , _prev_interval_usec{MAX_PUBLICATION_PERIOD_usec}
+  , _clock{}
+  {
+    _sub = _node_hdl.create_subscription<TSynchronization>(
+      [this](TSynchronization const & msg, TransferMetadata const & metadata)
+      {
+        onSynchronization_1_0_Received(msg, metadata);
+      });
+
+    _node_hdl.register_time_sync(this);
+  }
+
+  virtual ~TimeSyncSlave()
+  {
+    _node_hdl.unregister_time_sync(this);
+  }
+
+
+  [[nodiscard]] virtual std::optional<CanardMicrosecond> synchronized_micros(CanardMicrosecond const local_usec) const override
+  {
+    if (!_clock.is_valid())
+      return std::nullopt;
+    return _clock.convert(local_usec);
+  }
+
+
+private:
+  static CanardMicrosecond constexpr MAX_PUBLICATION_PERIOD_usec = TSynchronization::MAX_PUBLICATION_PERIOD * 1000 * 1000UL;
+
+  Node & _node_hdl;
+  cyphal::Subscription _sub;
+  CanardNodeID _master_node_id;
+  CanardMicrosecond _prev_rx_timestamp_usec;
+  CanardTransferID _prev_transfer_id;
+  CanardMicrosecond _prev_interval_usec;
+  DriftCompensatedClock _clock;
+
+  void onSynchronization_1_0_Received(TSynchronization const & msg, TransferMetadata const & metadata)
+  {
+    if (metadata.remote_node_id > CANARD_NODE_ID_MAX)
+      return;
+
+    CanardNodeID const node_id = static_cast<CanardNodeID>(metadata.remote_node_id);
+    CanardMicrosecond const interval_usec = metadata.timestamp_usec - _prev_rx_timestamp_usec;
+
+    /* The master with the lowest node-ID is dominant, it is replaced
+     * once silent for more than three times its publication interval.
+     */
+    bool const needs_init       = (_master_node_id == CANARD_NODE_ID_UNSET);
+    bool const switch_master    = (node_id < _master_node_id);
+    bool const master_timed_out = interval_usec > (TSynchronization::PUBLISHER_TIMEOUT_PERIOD_MULTIPLIER * _prev_interval_usec);
+
+    if (needs_init || switch_master || master_timed_out)
+    {
+      if (!needs_init && (node_id != _master_node_id))
+        _clock.reset();
+      store(node_id, metadata, MAX_PUBLICATION_PERIOD_usec);
+      return;
+    }
+
+    if (node_id != _master_node_id)
+      return;
+
+    /* The message contains the master's transmission timestamp of
+     * the previous message which is paired with its local reception
+     * timestamp, provided both refer to the same transfer.
+     */
+    bool const is_valid_tid    = (metadata.transfer_id == static_cast<CanardTransferID>((_prev_transfer_id + 1) & CANARD_TRANSFER_ID_MAX));
+    bool const is_valid_msg    = (msg.previous_transmission_timestamp_microsecond != 0);
+    bool const is_valid_timing = (interval_usec <= (2 * MAX_PUBLICATION_PERIOD_usec));
+
+    if (is_valid_tid && is_valid_msg && is_valid_timing)
+      _clock.update(_prev_rx_timestamp_usec, msg.previous_transmission_timestamp_microsecond);
+
+    store(node_id, metadata, interval_usec);
+  }
+
+  void store(CanardNodeID const node_id, TransferMetadata const & metadata, CanardMicrosecond const interval_usec)
+  {
+    _master_node_id = node_id;
+    _prev_rx_timestamp_usec = metadata.timestamp_usec;
+    _prev_transfer_id = metadata.transfer_id;
+    _prev_interval_usec = interval_usec;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
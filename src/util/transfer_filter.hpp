@@ -0,0 +1,109 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <bitset>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+
+#include "libcanard/canard.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Rejects received transfers before they are deserialized, e.g.
+ *
+ *   TransferFilter().from(42).payload([](uint8_t const * payload, size_t const size) { ... })
+ *
+ * A default constructed filter accepts every transfer.
+ */
+class TransferFilter final
+{
+public:
+  typedef std::function<bool(uint8_t const *, size_t const)> PayloadPredicate;
+
+
+  TransferFilter()
+  : _remote_node_ids{}
+  , _lowest_priority{CanardPriorityOptional}
+  , _payload_predicate{}
+  { }
+
+
+  /* Only accepts transfers from the given node, may be
+   * applied repeatedly to accept several nodes. Transfers
+   * of anonymous nodes are then rejected.
+   */
+  TransferFilter & from(CanardNodeID const remote_node_id)
+  {
+    if (remote_node_id <= CANARD_NODE_ID_MAX)
+      _remote_node_ids.set(remote_node_id);
+    return *this;
+  }
+  /* Rejects transfers of a lower priority than the given one. */
+  TransferFilter & with_priority(CanardPriority const lowest_priority)
+  {
+    _lowest_priority = lowest_priority;
+    return *this;
+  }
+  /* The predicate is invoked with the serialized payload. It
+   * may be shorter than the message, as trailing zero bytes
+   * may be omitted (implicit zero extension) and a payload
+   * exceeding the extent of the subscription is truncated.
+   */
+  TransferFilter & payload(PayloadPredicate predicate)
+  {
+    _payload_predicate = std::move(predicate);
+    return *this;
+  }
+
+
+  [[nodiscard]] bool accepts(CanardRxTransfer const & transfer) const
+  {
+    if (transfer.metadata.priority > _lowest_priority)
+      return false;
+
+    if (_remote_node_ids.any())
+    {
+      if (transfer.metadata.remote_node_id > CANARD_NODE_ID_MAX)
+        return false;
+      if (!_remote_node_ids.test(transfer.metadata.remote_node_id))
+        return false;
+    }
+
+    if (_payload_predicate)
+      return _payload_predicate(static_cast<uint8_t const *>(transfer.payload), transfer.payload_size);
+
+    return true;
+  }
+
+
+private:
+  std::bitset<CANARD_NODE_ID_MAX + 1> _remote_node_ids;
+  CanardPriority _lowest_priority;
+  PayloadPredicate _payload_predicate;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
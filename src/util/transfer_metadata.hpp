@@ -7,6 +7,12 @@
 
 #pragma once
 
+/**************************************************************************************
+ * INCLUDE
+ **************************************************************************************/
+
+#include <cstdint>
+
 /**************************************************************************************
  * NAMESPACE
  **************************************************************************************/
@@ -21,6 +27,8 @@ namespace cyphal
 struct TransferMetadata final
 {
   uint16_t remote_node_id;
+  uint8_t transfer_id;
+  uint64_t timestamp_usec; /* Local time of reception of the first frame of the transfer. */
   // More stuff may appear here in the future!
 };
 
@@ -0,0 +1,157 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+
+#include <libcanard/canard.h>
+
+#include "crc16ccitt.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+struct TransferHeader
+{
+  CanardPriority priority;
+  uint16_t source_node_id;
+  uint16_t destination_node_id;
+  CanardTransferKind transfer_kind;
+  CanardPortID port_id;
+  uint64_t transfer_id;
+  uint32_t frame_index;
+  bool end_of_transfer;
+};
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Encodes and decodes the 24 byte frame header shared by the
+ * Cyphal/UDP and Cyphal/serial transports (header version 1),
+ * all fields are little-endian except for the header CRC:
+ *
+ * uint4 version | void4 | uint3 priority | void5
+ * uint16 source node-ID | uint16 destination node-ID
+ * uint16 data specifier (bit 15: service, bit 14: request)
+ * uint64 transfer-ID | uint31 frame index | bool end of transfer
+ * uint16 user data | uint16 CRC-16/CCITT-FALSE (big-endian)
+ */
+class TransferHeaderCodec
+{
+public:
+  static size_t   constexpr HEADER_SIZE                      = 24;
+  static uint8_t  constexpr HEADER_VERSION                   = 1;
+  static uint16_t constexpr NODE_ID_UNSET                    = 0xFFFFU;
+  static uint16_t constexpr DATA_SPECIFIER_SERVICE           = 0x8000U;
+  static uint16_t constexpr DATA_SPECIFIER_REQUEST           = 0x4000U;
+  static uint16_t constexpr DATA_SPECIFIER_SERVICE_ID_MASK   = 0x3FFFU;
+  static uint16_t constexpr DATA_SPECIFIER_SUBJECT_ID_MASK   = 0x7FFFU;
+  static uint32_t constexpr FRAME_INDEX_MASK                 = 0x7FFFFFFFUL;
+  static uint32_t constexpr FRAME_INDEX_END_OF_TRANSFER      = 0x80000000UL;
+
+
+  static void encode(uint8_t * const buf, TransferHeader const & header)
+  {
+    uint16_t data_specifier = header.port_id & DATA_SPECIFIER_SUBJECT_ID_MASK;
+    if (header.transfer_kind == CanardTransferKindRequest)
+      data_specifier = DATA_SPECIFIER_SERVICE | DATA_SPECIFIER_REQUEST | (header.port_id & DATA_SPECIFIER_SERVICE_ID_MASK);
+    else if (header.transfer_kind == CanardTransferKindResponse)
+      data_specifier = DATA_SPECIFIER_SERVICE | (header.port_id & DATA_SPECIFIER_SERVICE_ID_MASK);
+
+    uint32_t const frame_index_eot = (header.frame_index & FRAME_INDEX_MASK) | (header.end_of_transfer ? FRAME_INDEX_END_OF_TRANSFER : 0);
+
+    buf[0] = HEADER_VERSION;
+    buf[1] = static_cast<uint8_t>(header.priority) & 0x07U;
+    put(buf + 2,  header.source_node_id,      2);
+    put(buf + 4,  header.destination_node_id, 2);
+    put(buf + 6,  data_specifier,             2);
+    put(buf + 8,  header.transfer_id,         8);
+    put(buf + 16, frame_index_eot,            4);
+    put(buf + 20, 0,                          2);
+
+    uint16_t const crc = crc16ccitt(buf, HEADER_SIZE - 2);
+    buf[22] = static_cast<uint8_t>(crc >> 8);
+    buf[23] = static_cast<uint8_t>(crc);
+  }
+
+  /* Headers of a different version or with a
+   * mismatching header CRC are not decoded.
+   */
+  [[nodiscard]] static std::optional<TransferHeader> decode(uint8_t const * const buf, size_t const size)
+  {
+    if (size < HEADER_SIZE)
+      return std::nullopt;
+
+    if ((buf[0] & 0x0FU) != HEADER_VERSION)
+      return std::nullopt;
+
+    uint16_t const crc = static_cast<uint16_t>((static_cast<uint16_t>(buf[22]) << 8) | buf[23]);
+    if (crc16ccitt(buf, HEADER_SIZE - 2) != crc)
+      return std::nullopt;
+
+    uint16_t const data_specifier  = static_cast<uint16_t>(get(buf + 6, 2));
+    uint32_t const frame_index_eot = static_cast<uint32_t>(get(buf + 16, 4));
+
+    TransferHeader header;
+    header.priority            = static_cast<CanardPriority>(buf[1] & 0x07U);
+    header.source_node_id      = static_cast<uint16_t>(get(buf + 2, 2));
+    header.destination_node_id = static_cast<uint16_t>(get(buf + 4, 2));
+    header.transfer_id         = get(buf + 8, 8);
+    header.frame_index         = frame_index_eot & FRAME_INDEX_MASK;
+    header.end_of_transfer     = (frame_index_eot & FRAME_INDEX_END_OF_TRANSFER) != 0;
+
+    if (data_specifier & DATA_SPECIFIER_SERVICE)
+    {
+      header.transfer_kind = (data_specifier & DATA_SPECIFIER_REQUEST) ? CanardTransferKindRequest : CanardTransferKindResponse;
+      header.port_id       = data_specifier & DATA_SPECIFIER_SERVICE_ID_MASK;
+    }
+    else
+    {
+      header.transfer_kind = CanardTransferKindMessage;
+      header.port_id       = data_specifier & DATA_SPECIFIER_SUBJECT_ID_MASK;
+    }
+
+    return header;
+  }
+
+
+private:
+  static void put(uint8_t * const buf, uint64_t const val, size_t const num_bytes)
+  {
+    for (size_t i = 0; i < num_bytes; i++)
+      buf[i] = static_cast<uint8_t>(val >> (8 * i));
+  }
+  static uint64_t get(uint8_t const * const buf, size_t const num_bytes)
+  {
+    uint64_t val = 0;
+    for (size_t i = 0; i < num_bytes; i++)
+      val |= static_cast<uint64_t>(buf[i]) << (8 * i);
+    return val;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
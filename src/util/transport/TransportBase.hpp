@@ -0,0 +1,490 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <cstring>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+#include "crc32c.hpp"
+#include "TransferHeaderCodec.hpp"
+#include "../../SubscriptionBase.h"
+#include "../queue/DispatchQueue.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Maps transfer sessions, i.e. transfer kind, port-ID and remote
+ * node-ID, to their last 64 bit transfer-ID. The least recently
+ * used session is replaced once the table is full.
+ */
+template <size_t CAPACITY>
+class TransferIdTable
+{
+public:
+  struct Entry
+  {
+    bool is_used;
+    CanardTransferKind transfer_kind;
+    CanardPortID port_id;
+    uint16_t node_id;
+    uint64_t transfer_id;
+    CanardMicrosecond timestamp_usec;
+    uint32_t last_use;
+  };
+
+
+  TransferIdTable() : _entries{}, _use_cnt{0} { }
+
+
+  [[nodiscard]] Entry * find(CanardTransferKind const transfer_kind, CanardPortID const port_id, uint16_t const node_id)
+  {
+    auto iter = std::find_if(_entries.begin(),
+                             _entries.end(),
+                             [&](Entry const & e)
+                             {
+                               return e.is_used && (e.transfer_kind == transfer_kind) && (e.port_id == port_id) && (e.node_id == node_id);
+                             });
+    if (iter == _entries.end())
+      return nullptr;
+
+    iter->last_use = ++_use_cnt;
+    return &(*iter);
+  }
+
+  [[nodiscard]] Entry & insert(CanardTransferKind const transfer_kind, CanardPortID const port_id, uint16_t const node_id)
+  {
+    auto iter = std::min_element(_entries.begin(),
+                                 _entries.end(),
+                                 [](Entry const & lhs, Entry const & rhs)
+                                 {
+                                   if (lhs.is_used != rhs.is_used)
+                                     return !lhs.is_used;
+                                   return lhs.last_use < rhs.last_use;
+                                 });
+    *iter = Entry{true, transfer_kind, port_id, node_id, 0, 0, ++_use_cnt};
+    return *iter;
+  }
+
+
+private:
+  std::array<Entry, CAPACITY> _entries;
+  uint32_t _use_cnt;
+};
+
+/* Transports other than CAN are operated by the node through this
+ * interface. Transfers are transmitted right away, directly from
+ * the serialization buffer of the publisher/service, and received
+ * transfers are dispatched to the subscriptions registered with
+ * the canard instance of the node, so that all endpoints work
+ * unchanged on any transport.
+ *
+ * Transfers are split into frames of up to mtu() payload bytes,
+ * the CRC-32C of the transfer is appended to the last frame.
+ * Single frame transfers are delivered straight from the receive
+ * buffer of the transport. Multi frame transfers are reassembled
+ * in order into a buffer allocated from the node heap, truncated
+ * to the extent of the subscription; out-of-order frames cause the
+ * transfer to be dropped.
+ *
+ * libcanard only keeps 8 bit transfer-IDs while the transfer-IDs
+ * of these transports are 64 bit wide and must never overflow.
+ * They are therefore extended per session on transmission and
+ * truncated on reception, responses are sent with the complete
+ * transfer-ID of the request they answer.
+ */
+class TransportBase
+{
+public:
+  static size_t constexpr MAX_TX_SESSIONS         = 16;
+  static size_t constexpr MAX_RX_SESSIONS         = 16;
+  static size_t constexpr MAX_REASSEMBLY_SESSIONS = 4;
+  static size_t constexpr TRANSFER_CRC_SIZE       = 4;
+
+
+  TransportBase(CanardInstance & canard_hdl)
+  : _canard_hdl{canard_hdl}
+  , _tx_transfer_ids{}
+  , _rx_transfer_ids{}
+  , _rx_sessions{}
+  , _dispatch_queue{nullptr}
+  { }
+  virtual ~TransportBase()
+  {
+    for (auto & session : _rx_sessions)
+      releaseSession(session);
+  }
+  TransportBase(TransportBase const &) = delete;
+  TransportBase(TransportBase &&) = delete;
+  TransportBase &operator=(TransportBase const &) = delete;
+  TransportBase &operator=(TransportBase &&) = delete;
+
+
+  [[nodiscard]] virtual size_t mtu() const = 0;
+
+  /* Invoked by the node whenever a port is (un)subscribed,
+   * e.g. in order to join/leave the respective multicast group.
+   * A failed subscribe() leaves the transport unchanged, i.e. it
+   * is not followed by unsubscribe().
+   */
+  [[nodiscard]] virtual bool subscribe(CanardTransferKind const transfer_kind, CanardPortID const port_id) = 0;
+  virtual void unsubscribe(CanardTransferKind const transfer_kind, CanardPortID const port_id) = 0;
+
+  /* Completed transfers are copied into the queue rather than
+   * dispatched right away, if set.
+   */
+  void setDispatchQueue(DispatchQueue * const dispatch_queue) { _dispatch_queue = dispatch_queue; }
+
+  /* Receives and dispatches the transfers pending at the platform. */
+  virtual void processRx(CanardMicrosecond const now_usec) = 0;
+
+  bool transmit(CanardTransferMetadata const & transfer_metadata, size_t const payload_size, uint8_t const * const payload)
+  {
+    bool const is_message = (transfer_metadata.transfer_kind == CanardTransferKindMessage);
+
+    TransferHeader header;
+    header.priority            = transfer_metadata.priority;
+    header.source_node_id      = localNodeId();
+    header.destination_node_id = is_message ? TransferHeaderCodec::NODE_ID_UNSET : transfer_metadata.remote_node_id;
+    header.transfer_kind       = transfer_metadata.transfer_kind;
+    header.port_id             = transfer_metadata.port_id;
+    header.transfer_id         = extendTransferId(transfer_metadata);
+    header.frame_index         = 0;
+    header.end_of_transfer     = true;
+
+    /* Anonymous nodes can only publish messages. */
+    if (!is_message && (header.source_node_id == TransferHeaderCodec::NODE_ID_UNSET))
+      return false;
+
+    return transmitTransfer(header, payload_size, payload);
+  }
+
+
+protected:
+  struct Slice
+  {
+    uint8_t const * data;
+    size_t size;
+  };
+
+  CanardInstance & _canard_hdl;
+
+
+  /* Transmits the complete transfer, the header is
+   * the one of the first frame of the transfer.
+   */
+  virtual bool transmitTransfer(TransferHeader const & header, size_t const payload_size, uint8_t const * const payload) = 0;
+
+
+  [[nodiscard]] uint16_t localNodeId() const
+  {
+    return (_canard_hdl.node_id <= CANARD_NODE_ID_MAX) ? _canard_hdl.node_id : TransferHeaderCodec::NODE_ID_UNSET;
+  }
+
+  /* Splits a transfer into frames of up to mtu_bytes payload bytes and
+   * invokes on_frame(header_buf, payload_slice, crc_slice) for each of
+   * them, the transfer CRC may be split across the last two frames.
+   * Stops and returns false as soon as on_frame() returns false.
+   */
+  template <typename OnFrameFunc>
+  static bool forEachFrame(TransferHeader const & header,
+                           size_t const payload_size,
+                           uint8_t const * const payload,
+                           size_t const mtu_bytes,
+                           OnFrameFunc && on_frame)
+  {
+    uint32_t const crc = Crc32c::compute(payload, payload_size);
+    std::array<uint8_t, TRANSFER_CRC_SIZE> crc_buf;
+    for (size_t i = 0; i < crc_buf.size(); i++)
+      crc_buf[i] = static_cast<uint8_t>(crc >> (8 * i));
+
+    size_t const transfer_size = payload_size + TRANSFER_CRC_SIZE;
+    TransferHeader frame_header = header;
+    std::array<uint8_t, TransferHeaderCodec::HEADER_SIZE> header_buf;
+
+    for (size_t offset = 0; offset < transfer_size; offset += mtu_bytes, frame_header.frame_index++)
+    {
+      size_t const end = std::min(offset + mtu_bytes, transfer_size);
+      frame_header.end_of_transfer = (end == transfer_size);
+      TransferHeaderCodec::encode(header_buf.data(), frame_header);
+
+      Slice payload_slice{payload, 0};
+      if (offset < payload_size)
+        payload_slice = Slice{payload + offset, std::min(end, payload_size) - offset};
+
+      Slice crc_slice{crc_buf.data(), 0};
+      if (end > payload_size) {
+        size_t const crc_offset = std::max(offset, payload_size) - payload_size;
+        crc_slice = Slice{crc_buf.data() + crc_offset, (end - payload_size) - crc_offset};
+      }
+
+      if (!on_frame(header_buf, payload_slice, crc_slice))
+        return false;
+    }
+
+    return true;
+  }
+
+  /* Processes a received frame, i.e. the header and the payload
+   * following it, which must remain valid for the duration of the
+   * call only.
+   */
+  void processRxFrame(TransferHeader const & header, uint8_t * const payload, size_t const payload_size, CanardMicrosecond const timestamp_usec)
+  {
+    CanardRxSubscription * rx_subscription = findRxSubscription(header);
+    if (!rx_subscription)
+      return;
+
+    if ((header.frame_index == 0) && header.end_of_transfer)
+    {
+      if (payload_size < TRANSFER_CRC_SIZE)
+        return;
+      if (Crc32c::add(Crc32c::INITIAL, payload, payload_size) != Crc32c::RESIDUE)
+        return;
+      if (!acceptTransferId(header, *rx_subscription, timestamp_usec))
+        return;
+
+      dispatch(*rx_subscription, header, timestamp_usec, payload_size - TRANSFER_CRC_SIZE, payload);
+      return;
+    }
+
+    RxSession * session = (header.frame_index == 0) ?
+      startSession(header, *rx_subscription, timestamp_usec) : findSession(header);
+    if (!session)
+      return;
+
+    size_t const stored_size = std::min(session->transfer_size, session->payload_capacity);
+    size_t const num_stored = std::min(payload_size, session->payload_capacity - stored_size);
+    std::memcpy(session->payload + stored_size, payload, num_stored);
+    session->transfer_size += payload_size;
+    session->crc = Crc32c::add(session->crc, payload, payload_size);
+    session->next_frame_index++;
+
+    if (!header.end_of_transfer)
+      return;
+
+    if ((session->transfer_size >= TRANSFER_CRC_SIZE) &&
+        (session->crc == Crc32c::RESIDUE) &&
+        acceptTransferId(session->header, *rx_subscription, session->timestamp_usec))
+    {
+      dispatch(*rx_subscription, session->header, session->timestamp_usec, session->transfer_size - TRANSFER_CRC_SIZE, session->payload);
+    }
+    releaseSession(*session);
+  }
+
+
+private:
+  struct RxSession
+  {
+    bool is_active;
+    TransferHeader header;
+    CanardMicrosecond timestamp_usec;
+    uint32_t next_frame_index;
+    size_t transfer_size;
+    uint32_t crc;
+    uint8_t * payload;
+    size_t payload_capacity;
+  };
+
+  TransferIdTable<MAX_TX_SESSIONS> _tx_transfer_ids;
+  TransferIdTable<MAX_RX_SESSIONS> _rx_transfer_ids;
+  std::array<RxSession, MAX_REASSEMBLY_SESSIONS> _rx_sessions;
+  DispatchQueue * _dispatch_queue;
+
+
+  /* Returns the subscription a received transfer is to be delivered to or
+   * nullptr if the transfer is not addressed to this node, not subscribed
+   * or was sent by this node itself (i.e. looped back by the platform).
+   */
+  [[nodiscard]] CanardRxSubscription * findRxSubscription(TransferHeader const & header) const
+  {
+    uint16_t const local_node_id = localNodeId();
+
+    if ((local_node_id != TransferHeaderCodec::NODE_ID_UNSET) && (header.source_node_id == local_node_id))
+      return nullptr;
+
+    if (header.transfer_kind == CanardTransferKindMessage)
+    {
+      if (header.destination_node_id != TransferHeaderCodec::NODE_ID_UNSET)
+        return nullptr;
+    }
+    else
+    {
+      if ((local_node_id == TransferHeaderCodec::NODE_ID_UNSET) || (header.destination_node_id != local_node_id))
+        return nullptr;
+      if (header.source_node_id > CANARD_NODE_ID_MAX)
+        return nullptr;
+    }
+
+    /* The subscriptions are kept in an AVL tree ordered by port-ID. */
+    CanardTreeNode * node = _canard_hdl.rx_subscriptions[header.transfer_kind];
+    while (node != nullptr)
+    {
+      CanardRxSubscription * sub = reinterpret_cast<CanardRxSubscription *>(node);
+      if (sub->port_id == header.port_id)
+        return sub;
+      node = node->lr[header.port_id > sub->port_id];
+    }
+    return nullptr;
+  }
+
+  /* Rejects duplicated transfers, i.e. transfers whose transfer-ID is not
+   * newer than the last one received within the transfer-ID timeout.
+   */
+  [[nodiscard]] bool acceptTransferId(TransferHeader const & header, CanardRxSubscription const & rx_subscription, CanardMicrosecond const timestamp_usec)
+  {
+    if (header.source_node_id == TransferHeaderCodec::NODE_ID_UNSET)
+      return true;
+
+    auto entry = _rx_transfer_ids.find(header.transfer_kind, header.port_id, header.source_node_id);
+    if (entry)
+    {
+      bool const is_timed_out = (timestamp_usec - entry->timestamp_usec) > rx_subscription.transfer_id_timeout_usec;
+      if (!is_timed_out && (header.transfer_id <= entry->transfer_id))
+        return false;
+    }
+    else
+      entry = &_rx_transfer_ids.insert(header.transfer_kind, header.port_id, header.source_node_id);
+
+    entry->transfer_id    = header.transfer_id;
+    entry->timestamp_usec = timestamp_usec;
+    return true;
+  }
+
+  /* The payload is only borrowed for the duration of the call. */
+  void dispatch(CanardRxSubscription & rx_subscription, TransferHeader const & header, CanardMicrosecond const timestamp_usec, size_t const payload_size, void * payload)
+  {
+    CanardRxTransfer transfer;
+    transfer.metadata.priority       = header.priority;
+    transfer.metadata.transfer_kind  = header.transfer_kind;
+    transfer.metadata.port_id        = header.port_id;
+    transfer.metadata.remote_node_id = (header.source_node_id <= CANARD_NODE_ID_MAX) ? static_cast<CanardNodeID>(header.source_node_id) : CANARD_NODE_ID_UNSET;
+    transfer.metadata.transfer_id    = static_cast<CanardTransferID>(header.transfer_id);
+    transfer.timestamp_usec          = timestamp_usec;
+    transfer.payload_size            = std::min(payload_size, rx_subscription.extent);
+    transfer.payload                 = payload;
+
+    SubscriptionBase * const sub = static_cast<SubscriptionBase *>(rx_subscription.user_reference);
+    if (_dispatch_queue)
+      _dispatch_queue->pushCopy(*sub, transfer);
+    else
+      sub->onTransferReceived(transfer);
+  }
+
+
+  [[nodiscard]] uint64_t extendTransferId(CanardTransferMetadata const & transfer_metadata)
+  {
+    uint8_t const transfer_id = transfer_metadata.transfer_id;
+
+    /* A response carries the transfer-ID of the request received last. */
+    if (transfer_metadata.transfer_kind == CanardTransferKindResponse)
+    {
+      auto const entry = _rx_transfer_ids.find(CanardTransferKindRequest, transfer_metadata.port_id, transfer_metadata.remote_node_id);
+      if (!entry)
+        return transfer_id;
+      return entry->transfer_id - static_cast<uint8_t>(static_cast<uint8_t>(entry->transfer_id) - transfer_id);
+    }
+
+    uint16_t const remote_node_id = (transfer_metadata.transfer_kind == CanardTransferKindMessage) ? TransferHeaderCodec::NODE_ID_UNSET : transfer_metadata.remote_node_id;
+
+    auto entry = _tx_transfer_ids.find(transfer_metadata.transfer_kind, transfer_metadata.port_id, remote_node_id);
+    if (!entry) {
+      entry = &_tx_transfer_ids.insert(transfer_metadata.transfer_kind, transfer_metadata.port_id, remote_node_id);
+      entry->transfer_id = transfer_id;
+      return entry->transfer_id;
+    }
+
+    uint64_t const next_transfer_id = entry->transfer_id + 1;
+    entry->transfer_id = next_transfer_id + static_cast<uint8_t>(transfer_id - static_cast<uint8_t>(next_transfer_id));
+    return entry->transfer_id;
+  }
+
+  /* A new transfer replaces any unfinished transfer of the same remote
+   * port, otherwise a free or the least recently started session is used.
+   */
+  RxSession * startSession(TransferHeader const & header, CanardRxSubscription const & rx_subscription, CanardMicrosecond const timestamp_usec)
+  {
+    auto iter = std::find_if(_rx_sessions.begin(),
+                             _rx_sessions.end(),
+                             [&header](RxSession const & s)
+                             {
+                               return s.is_active && isSameSession(s.header, header);
+                             });
+    if (iter == _rx_sessions.end())
+      iter = std::min_element(_rx_sessions.begin(),
+                              _rx_sessions.end(),
+                              [](RxSession const & lhs, RxSession const & rhs)
+                              {
+                                if (lhs.is_active != rhs.is_active)
+                                  return !lhs.is_active;
+                                return lhs.timestamp_usec < rhs.timestamp_usec;
+                              });
+    releaseSession(*iter);
+
+    size_t const payload_capacity = rx_subscription.extent + TRANSFER_CRC_SIZE;
+    uint8_t * payload = static_cast<uint8_t *>(_canard_hdl.memory_allocate(&_canard_hdl, payload_capacity));
+    if (!payload)
+      return nullptr;
+
+    *iter = RxSession{true, header, timestamp_usec, 0, 0, Crc32c::INITIAL, payload, payload_capacity};
+    return &(*iter);
+  }
+
+  RxSession * findSession(TransferHeader const & header)
+  {
+    auto iter = std::find_if(_rx_sessions.begin(),
+                             _rx_sessions.end(),
+                             [&header](RxSession const & s)
+                             {
+                               return s.is_active && isSameSession(s.header, header) && (s.header.transfer_id == header.transfer_id);
+                             });
+    if (iter == _rx_sessions.end())
+      return nullptr;
+
+    if (iter->next_frame_index != header.frame_index) {
+      releaseSession(*iter);
+      return nullptr;
+    }
+    return &(*iter);
+  }
+
+  void releaseSession(RxSession & session)
+  {
+    if (session.is_active)
+      _canard_hdl.memory_free(&_canard_hdl, session.payload);
+    session.is_active = false;
+    session.payload = nullptr;
+  }
+
+  static bool isSameSession(TransferHeader const & lhs, TransferHeader const & rhs)
+  {
+    return (lhs.transfer_kind  == rhs.transfer_kind) &&
+           (lhs.port_id        == rhs.port_id) &&
+           (lhs.source_node_id == rhs.source_node_id);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -0,0 +1,49 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+/* CRC-16/CCITT-FALSE protecting the transfer header
+ * of the Cyphal/UDP and Cyphal/serial transports.
+ */
+inline uint16_t crc16ccitt(uint8_t const * data, size_t const size)
+{
+  static uint16_t constexpr POLY = 0x1021U;
+
+  uint16_t crc = 0xFFFFU;
+  for (size_t i = 0; i < size; i++)
+  {
+    crc ^= static_cast<uint16_t>(static_cast<uint16_t>(data[i]) << 8U);
+    for (size_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x8000U) ? static_cast<uint16_t>((crc << 1U) ^ POLY) : static_cast<uint16_t>(crc << 1U);
+  }
+  return crc;
+}
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -0,0 +1,91 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * FUNCTION DEFINITION
+ **************************************************************************************/
+
+constexpr std::array<uint32_t, 256> makeCrc32cTable()
+{
+  /* Reflected polynomial 0x1EDC6F41. */
+  std::array<uint32_t, 256> table{};
+  for (uint32_t i = 0; i < table.size(); i++)
+  {
+    uint32_t crc = i;
+    for (size_t bit = 0; bit < 8; bit++)
+      crc = (crc & 1U) ? ((crc >> 1U) ^ 0x82F63B78UL) : (crc >> 1U);
+    table[i] = crc;
+  }
+  return table;
+}
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* CRC-32C (Castagnoli) protecting the payload of Cyphal/UDP and
+ * Cyphal/serial transfers. The CRC is computed incrementally and
+ * table driven as transfers may be up to several kilobytes long:
+ *
+ *   uint32_t crc = Crc32c::INITIAL;
+ *   crc = Crc32c::add(crc, data, size);
+ *   uint32_t const value = Crc32c::finalize(crc);
+ *
+ * Running the CRC over the data followed by its little-endian
+ * encoded CRC yields RESIDUE (before finalization).
+ */
+class Crc32c
+{
+public:
+  static uint32_t constexpr INITIAL = 0xFFFFFFFFUL;
+  static uint32_t constexpr RESIDUE = 0xB798B438UL;
+
+
+  [[nodiscard]] static uint32_t add(uint32_t crc, uint8_t const * data, size_t const size)
+  {
+    for (size_t i = 0; i < size; i++)
+      crc = TABLE[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8U);
+    return crc;
+  }
+
+  [[nodiscard]] static constexpr uint32_t finalize(uint32_t const crc)
+  {
+    return crc ^ 0xFFFFFFFFUL;
+  }
+
+  [[nodiscard]] static uint32_t compute(uint8_t const * data, size_t const size)
+  {
+    return finalize(add(INITIAL, data, size));
+  }
+
+
+private:
+  static std::array<uint32_t, 256> constexpr TABLE = makeCrc32cTable();
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -0,0 +1,193 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Consistent Overhead Byte Stuffing: encodes data which may
+ * contain zero bytes into a sequence without any zero bytes, so
+ * that zero bytes can delimit the frames of a byte stream. The
+ * data of a frame is encoded in one or more consecutive chunks:
+ *
+ *   CobsEncoder encoder(buf);
+ *   encoder.add(header, header_size);
+ *   encoder.add(payload, payload_size);
+ *   size_t const encoded_size = encoder.finish();
+ */
+class CobsEncoder
+{
+public:
+  static size_t constexpr MAX_BLOCK_CODE = 0xFF;
+
+
+  /* The worst case size of size encoded bytes, excluding any delimiter. */
+  [[nodiscard]] static constexpr size_t maxEncodedSize(size_t const size)
+  {
+    return size + (size / (MAX_BLOCK_CODE - 1)) + 1;
+  }
+
+
+  CobsEncoder(uint8_t * const buf)
+  : _buf{buf}
+  , _pos{1}
+  , _code_pos{0}
+  , _code{1}
+  { }
+
+
+  void add(uint8_t const * const data, size_t const size)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      if (data[i] == 0) {
+        closeBlock();
+        continue;
+      }
+
+      _buf[_pos++] = data[i];
+      if (++_code == MAX_BLOCK_CODE)
+        closeBlock();
+    }
+  }
+
+  /* Returns the number of encoded bytes. */
+  [[nodiscard]] size_t finish()
+  {
+    _buf[_code_pos] = static_cast<uint8_t>(_code);
+    return _pos;
+  }
+
+
+private:
+  uint8_t * const _buf;
+  size_t _pos;
+  size_t _code_pos;
+  size_t _code;
+
+  void closeBlock()
+  {
+    _buf[_code_pos] = static_cast<uint8_t>(_code);
+    _code_pos = _pos++;
+    _code = 1;
+  }
+};
+
+/* Incrementally decodes COBS encoded, zero delimited frames from a
+ * byte stream into a buffer of the given capacity. Frames exceeding
+ * the capacity are discarded up to the next delimiter:
+ *
+ *   for (size_t i = 0; i < num_bytes; i++)
+ *     if (decoder.decode(bytes[i]))
+ *       processFrame(decoder.data(), decoder.size());
+ */
+class CobsDecoder
+{
+public:
+  CobsDecoder(uint8_t * const buf, size_t const capacity)
+  : _buf{buf}
+  , _capacity{capacity}
+  {
+    reset();
+  }
+
+
+  /* Returns true if byte completed a non-empty frame, which remains
+   * accessible via data() and size() until the next call to decode().
+   */
+  [[nodiscard]] bool decode(uint8_t const byte)
+  {
+    if (_is_complete)
+      reset();
+
+    if (byte == 0)
+    {
+      /* Truncated blocks and empty frames, e.g. caused by
+       * consecutive delimiters, are silently skipped.
+       */
+      bool const is_valid = !_is_overflow && (_remaining == 0) && (_size > 0);
+      if (!is_valid) {
+        reset();
+        return false;
+      }
+      _is_complete = true;
+      return true;
+    }
+
+    if (_is_overflow)
+      return false;
+
+    if (_remaining == 0)
+    {
+      /* The implicit zero terminating the previous block is only
+       * appended once another block follows.
+       */
+      if (_is_zero_pending)
+        append(0);
+      _remaining = byte - 1;
+      _is_zero_pending = (byte != CobsEncoder::MAX_BLOCK_CODE);
+      return false;
+    }
+
+    append(byte);
+    _remaining--;
+    return false;
+  }
+
+  [[nodiscard]] uint8_t * data() const { return _buf; }
+  [[nodiscard]] size_t size() const { return _size; }
+
+
+private:
+  uint8_t * const _buf;
+  size_t const _capacity;
+  size_t _size;
+  size_t _remaining;
+  bool _is_zero_pending;
+  bool _is_overflow;
+  bool _is_complete;
+
+  void reset()
+  {
+    _size = 0;
+    _remaining = 0;
+    _is_zero_pending = false;
+    _is_overflow = false;
+    _is_complete = false;
+  }
+
+  void append(uint8_t const byte)
+  {
+    if (_size == _capacity) {
+      _is_overflow = true;
+      return;
+    }
+    _buf[_size++] = byte;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
@@ -0,0 +1,53 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <variant>
+
+namespace cyphal::support::platform::serial
+{
+
+enum class Error : std::uint8_t
+{
+    API,          ///< Bad API invocation.
+    Busy,         ///< The data can not be written right now, e.g. the TX buffer is full.
+    IO,           ///< Input/output error of the port.
+    Internal,     ///< Internal failure of the port.
+};
+
+namespace interface
+{
+
+/// A byte stream such as a UART, USB-CDC or a pseudo terminal on a Linux host.
+/// All functions are executed from within Node::spinSome() and must not block.
+class SerialPort
+{
+public:
+    SerialPort()                                     = default;
+    SerialPort(const SerialPort&)                    = delete;
+    SerialPort(SerialPort&&)                         = delete;
+    auto operator=(const SerialPort&) -> SerialPort& = delete;
+    auto operator=(SerialPort&&) -> SerialPort&      = delete;
+    virtual ~SerialPort()                            = default;
+
+    /// Writes a complete transfer (one or more delimited frames) at once, e.g. by a single
+    /// DMA transaction. Either all or none of the bytes are written. The data is only valid
+    /// for the duration of the call, an asynchronous transmission has to copy it.
+    [[nodiscard]] virtual auto write(const void* const data, const std::size_t size) -> std::optional<Error> = 0;
+
+    /// Copies up to size received bytes into the buffer. The return value is the
+    /// number of bytes read, zero if none are pending, or the error.
+    [[nodiscard]] virtual auto read(void* const data, const std::size_t size) -> std::variant<Error, std::size_t> = 0;
+};
+
+} /* interface */
+
+} /* cyphal::support::platform::serial */
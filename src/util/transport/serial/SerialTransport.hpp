@@ -0,0 +1,144 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "Cobs.hpp"
+#include "SerialPort.hpp"
+
+#include "../TransportBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Cyphal/serial over a byte stream: each frame (header, payload
+ * slice and, for the last frame, the transfer CRC) is COBS encoded
+ * and enclosed in zero delimiters. All frames of a transfer are
+ * encoded into a single contiguous buffer which is handed to the
+ * serial port at once.
+ *
+ * Received bytes are read in chunks of RX_CHUNK_SIZE and decoded
+ * in place, i.e. without any further call into the serial port per
+ * byte. Frames larger than the local MTU are discarded.
+ */
+class SerialTransport final : public TransportBase
+{
+public:
+  typedef support::platform::serial::interface::SerialPort SerialPort;
+
+  static uint8_t constexpr FRAME_DELIMITER        = 0;
+  static size_t  constexpr MIN_MTU_SIZE           = TRANSFER_CRC_SIZE;
+  static size_t  constexpr RX_CHUNK_SIZE          = 256;
+  /* Bounds the time spent in a single spinSome(). */
+  static size_t  constexpr MAX_RX_CHUNKS_PER_SPIN = 16;
+
+
+  SerialTransport(CanardInstance & canard_hdl, SerialPort & serial_port, size_t const mtu_bytes)
+  : TransportBase{canard_hdl}
+  , _serial_port{serial_port}
+  , _mtu_bytes{std::max(mtu_bytes, MIN_MTU_SIZE)}
+  , _tx_buffer{}
+  , _rx_frame(TransferHeaderCodec::HEADER_SIZE + _mtu_bytes)
+  , _rx_decoder{_rx_frame.data(), _rx_frame.size()}
+  , _rx_chunk{}
+  { }
+
+
+  [[nodiscard]] virtual size_t mtu() const override { return _mtu_bytes; }
+
+  /* All transfers are received via the same byte stream. */
+  [[nodiscard]] virtual bool subscribe(CanardTransferKind const, CanardPortID const) override { return true; }
+  virtual void unsubscribe(CanardTransferKind const, CanardPortID const) override { }
+
+  virtual void processRx(CanardMicrosecond const now_usec) override
+  {
+    for (size_t chunk = 0; chunk < MAX_RX_CHUNKS_PER_SPIN; chunk++)
+    {
+      auto const rc = _serial_port.read(_rx_chunk.data(), _rx_chunk.size());
+      if (!std::holds_alternative<size_t>(rc))
+        return;
+
+      size_t const num_bytes = std::min(std::get<size_t>(rc), _rx_chunk.size());
+      for (size_t i = 0; i < num_bytes; i++)
+        if (_rx_decoder.decode(_rx_chunk[i]))
+          processSerialFrame(_rx_decoder.data(), _rx_decoder.size(), now_usec);
+
+      if (num_bytes < _rx_chunk.size())
+        return;
+    }
+  }
+
+
+protected:
+  virtual bool transmitTransfer(TransferHeader const & header, size_t const payload_size, uint8_t const * const payload) override
+  {
+    size_t const transfer_size = payload_size + TRANSFER_CRC_SIZE;
+    size_t const num_frames = (transfer_size + _mtu_bytes - 1) / _mtu_bytes;
+    size_t const max_frame_size = 2 + CobsEncoder::maxEncodedSize(TransferHeaderCodec::HEADER_SIZE + _mtu_bytes);
+
+    /* The buffer grows to the size of the largest transfer once. */
+    if (_tx_buffer.size() < (num_frames * max_frame_size))
+      _tx_buffer.resize(num_frames * max_frame_size);
+
+    size_t tx_size = 0;
+    (void)forEachFrame(header, payload_size, payload, _mtu_bytes,
+                       [this, &tx_size](auto const & header_buf, Slice const & payload_slice, Slice const & crc_slice)
+                       {
+                         _tx_buffer[tx_size++] = FRAME_DELIMITER;
+                         CobsEncoder encoder(_tx_buffer.data() + tx_size);
+                         encoder.add(header_buf.data(), header_buf.size());
+                         encoder.add(payload_slice.data, payload_slice.size);
+                         encoder.add(crc_slice.data, crc_slice.size);
+                         tx_size += encoder.finish();
+                         _tx_buffer[tx_size++] = FRAME_DELIMITER;
+                         return true;
+                       });
+
+    return !_serial_port.write(_tx_buffer.data(), tx_size).has_value();
+  }
+
+
+private:
+  SerialPort & _serial_port;
+  size_t const _mtu_bytes;
+  std::vector<uint8_t> _tx_buffer;
+  std::vector<uint8_t> _rx_frame;
+  CobsDecoder _rx_decoder;
+  std::array<uint8_t, RX_CHUNK_SIZE> _rx_chunk;
+
+
+  void processSerialFrame(uint8_t * const data, size_t const size, CanardMicrosecond const timestamp_usec)
+  {
+    auto const header = TransferHeaderCodec::decode(data, size);
+    if (!header.has_value())
+      return;
+
+    processRxFrame(header.value(), data + TransferHeaderCodec::HEADER_SIZE, size - TransferHeaderCodec::HEADER_SIZE, timestamp_usec);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
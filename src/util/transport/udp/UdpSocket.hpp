@@ -0,0 +1,76 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <variant>
+
+namespace cyphal::support::platform::udp
+{
+
+enum class Error : std::uint8_t
+{
+    API,          ///< Bad API invocation (e.g., invalid multicast group).
+    Busy,         ///< The datagram can not be sent right now, e.g. the socket buffer is full.
+    IO,           ///< Network input/output error.
+    Internal,     ///< Internal failure of the socket.
+};
+
+/// One contiguous part of a datagram which is sent by gathering several such buffers.
+struct Fragment
+{
+    const void* data;
+    std::size_t size;
+};
+
+/// A receive buffer, size is set to the length of the received datagram.
+struct Datagram
+{
+    void* data;
+    std::size_t capacity;
+    std::size_t size;
+};
+
+namespace interface
+{
+
+/// A UDP/IPv4 socket bound to the Cyphal/UDP port (9382) of the local network interface,
+/// e.g. a BSD socket on a Linux host or the socket of the network stack of a MCU.
+/// Datagrams sent to a multicast group the socket has joined itself shall be looped back.
+/// All functions are executed from within Node::spinSome() and must not block.
+class UdpSocket
+{
+public:
+    UdpSocket()                                    = default;
+    UdpSocket(const UdpSocket&)                    = delete;
+    UdpSocket(UdpSocket&&)                         = delete;
+    auto operator=(const UdpSocket&) -> UdpSocket& = delete;
+    auto operator=(UdpSocket&&) -> UdpSocket&      = delete;
+    virtual ~UdpSocket()                           = default;
+
+    /// Sends a single datagram made up of the given fragments (scatter-gather) to the
+    /// multicast group (IPv4 address in host byte order) at the Cyphal/UDP port.
+    [[nodiscard]] virtual auto send(const std::uint32_t group_address,
+                                    const Fragment* const fragments,
+                                    const std::size_t num_fragments) -> std::optional<Error> = 0;
+
+    /// Receives up to num_datagrams pending datagrams at once. Datagrams larger than the
+    /// capacity of the buffer may be truncated. The return value is the number of received
+    /// datagrams, zero if none is pending, or the error.
+    [[nodiscard]] virtual auto receive(Datagram* const datagrams,
+                                       const std::size_t num_datagrams) -> std::variant<Error, std::size_t> = 0;
+
+    [[nodiscard]] virtual auto join(const std::uint32_t group_address) -> std::optional<Error> = 0;
+    virtual void leave(const std::uint32_t group_address) = 0;
+};
+
+} /* interface */
+
+} /* cyphal::support::platform::udp */
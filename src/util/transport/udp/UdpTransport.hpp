@@ -0,0 +1,215 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <array>
+#include <vector>
+#include <optional>
+#include <algorithm>
+
+#include "UdpSocket.hpp"
+
+#include "../TransportBase.hpp"
+#include "../../port/PortSet.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal::impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Cyphal/UDP over IPv4 multicast: messages are sent to the group
+ * 239.0.<subject-ID>, service transfers to 239.1.<destination
+ * node-ID>. Each frame is a single datagram made up of the frame
+ * header and a slice of the serialized payload, gathered by the
+ * socket directly from the serialization buffer. Datagrams are
+ * received in batches of RX_BATCH_SIZE.
+ */
+class UdpTransport final : public TransportBase
+{
+public:
+  typedef support::platform::udp::interface::UdpSocket UdpSocket;
+  typedef support::platform::udp::Fragment Fragment;
+  typedef support::platform::udp::Datagram Datagram;
+
+  static uint32_t constexpr SUBJECT_MULTICAST_PREFIX = 0xEF000000UL; /* 239.0.0.0 */
+  static uint32_t constexpr SERVICE_MULTICAST_PREFIX = 0xEF010000UL; /* 239.1.0.0 */
+  static size_t   constexpr MIN_MTU_SIZE             = TRANSFER_CRC_SIZE;
+  /* The largest UDP payload fitting into an Ethernet frame, datagrams
+   * are received up to this size even if the local MTU is smaller.
+   */
+  static size_t   constexpr MIN_RX_DATAGRAM_SIZE     = 1472;
+  static size_t   constexpr RX_BATCH_SIZE            = 8;
+  /* Bounds the time spent in a single spinSome(). */
+  static size_t   constexpr MAX_RX_BATCHES_PER_SPIN  = 4;
+
+
+  UdpTransport(CanardInstance & canard_hdl, UdpSocket & udp_socket, size_t const mtu_bytes)
+  : TransportBase{canard_hdl}
+  , _udp_socket{udp_socket}
+  , _mtu_bytes{std::max(mtu_bytes, MIN_MTU_SIZE)}
+  , _rx_datagram_size{std::max(TransferHeaderCodec::HEADER_SIZE + _mtu_bytes, MIN_RX_DATAGRAM_SIZE)}
+  , _rx_buffer(RX_BATCH_SIZE * _rx_datagram_size)
+  , _rx_datagrams{}
+  , _subject_groups{}
+  , _num_service_ports{0}
+  , _service_group_node_id{std::nullopt}
+  { }
+
+  virtual ~UdpTransport()
+  {
+    for (auto const & [subject_id, cnt] : _subject_groups)
+      _udp_socket.leave(SUBJECT_MULTICAST_PREFIX | subject_id);
+    if (_service_group_node_id.has_value())
+      _udp_socket.leave(SERVICE_MULTICAST_PREFIX | _service_group_node_id.value());
+  }
+
+
+  [[nodiscard]] virtual size_t mtu() const override { return _mtu_bytes; }
+
+  [[nodiscard]] virtual bool subscribe(CanardTransferKind const transfer_kind, CanardPortID const port_id) override
+  {
+    if (transfer_kind != CanardTransferKindMessage)
+    {
+      _num_service_ports++;
+      if (updateServiceGroup())
+        return true;
+      _num_service_ports--;
+      return false;
+    }
+
+    if (!_subject_groups.add(port_id))
+      return true;
+
+    if (_udp_socket.join(SUBJECT_MULTICAST_PREFIX | port_id).has_value()) {
+      _subject_groups.remove(port_id);
+      return false;
+    }
+    return true;
+  }
+
+  virtual void unsubscribe(CanardTransferKind const transfer_kind, CanardPortID const port_id) override
+  {
+    if (transfer_kind != CanardTransferKindMessage)
+    {
+      if (_num_service_ports > 0)
+        _num_service_ports--;
+      (void)updateServiceGroup();
+      return;
+    }
+
+    if (_subject_groups.remove(port_id))
+      _udp_socket.leave(SUBJECT_MULTICAST_PREFIX | port_id);
+  }
+
+  virtual void processRx(CanardMicrosecond const now_usec) override
+  {
+    /* Follows changes of the local node-ID, e.g. due to plug-and-play. */
+    (void)updateServiceGroup();
+
+    for (size_t batch = 0; batch < MAX_RX_BATCHES_PER_SPIN; batch++)
+    {
+      for (size_t i = 0; i < RX_BATCH_SIZE; i++)
+        _rx_datagrams[i] = Datagram{_rx_buffer.data() + i * _rx_datagram_size, _rx_datagram_size, 0};
+
+      auto const rc = _udp_socket.receive(_rx_datagrams.data(), _rx_datagrams.size());
+      if (!std::holds_alternative<size_t>(rc))
+        return;
+
+      size_t const num_datagrams = std::min(std::get<size_t>(rc), _rx_datagrams.size());
+      for (size_t i = 0; i < num_datagrams; i++)
+        processRxDatagram(static_cast<uint8_t *>(_rx_datagrams[i].data), std::min(_rx_datagrams[i].size, _rx_datagram_size), now_usec);
+
+      if (num_datagrams < _rx_datagrams.size())
+        return;
+    }
+  }
+
+
+protected:
+  virtual bool transmitTransfer(TransferHeader const & header, size_t const payload_size, uint8_t const * const payload) override
+  {
+    uint32_t const group_address = (header.transfer_kind == CanardTransferKindMessage) ?
+      (SUBJECT_MULTICAST_PREFIX | header.port_id) : (SERVICE_MULTICAST_PREFIX | header.destination_node_id);
+
+    return forEachFrame(header, payload_size, payload, _mtu_bytes,
+                        [this, group_address](auto const & header_buf, Slice const & payload_slice, Slice const & crc_slice)
+                        {
+                          std::array<Fragment, 3> fragments;
+                          size_t num_fragments = 0;
+                          fragments[num_fragments++] = Fragment{header_buf.data(), header_buf.size()};
+                          if (payload_slice.size > 0)
+                            fragments[num_fragments++] = Fragment{payload_slice.data, payload_slice.size};
+                          if (crc_slice.size > 0)
+                            fragments[num_fragments++] = Fragment{crc_slice.data, crc_slice.size};
+
+                          return !_udp_socket.send(group_address, fragments.data(), num_fragments).has_value();
+                        });
+  }
+
+
+private:
+  UdpSocket & _udp_socket;
+  size_t const _mtu_bytes;
+  size_t const _rx_datagram_size;
+  std::vector<uint8_t> _rx_buffer;
+  std::array<Datagram, RX_BATCH_SIZE> _rx_datagrams;
+  PortSet _subject_groups;
+  size_t _num_service_ports;
+  std::optional<uint16_t> _service_group_node_id;
+
+
+  /* Service transfers are received via the multicast group of
+   * the local node-ID, which anonymous nodes can not join.
+   */
+  bool updateServiceGroup()
+  {
+    std::optional<uint16_t> group_node_id = std::nullopt;
+    if ((_num_service_ports > 0) && (localNodeId() != TransferHeaderCodec::NODE_ID_UNSET))
+      group_node_id = localNodeId();
+
+    if (group_node_id == _service_group_node_id)
+      return true;
+
+    if (_service_group_node_id.has_value())
+      _udp_socket.leave(SERVICE_MULTICAST_PREFIX | _service_group_node_id.value());
+    _service_group_node_id = std::nullopt;
+
+    if (group_node_id.has_value())
+    {
+      if (_udp_socket.join(SERVICE_MULTICAST_PREFIX | group_node_id.value()).has_value())
+        return false;
+      _service_group_node_id = group_node_id;
+    }
+    return true;
+  }
+
+  void processRxDatagram(uint8_t * const data, size_t const size, CanardMicrosecond const timestamp_usec)
+  {
+    auto const header = TransferHeaderCodec::decode(data, size);
+    if (!header.has_value())
+      return;
+
+    processRxFrame(header.value(), data + TransferHeaderCodec::HEADER_SIZE, size - TransferHeaderCodec::HEADER_SIZE, timestamp_usec);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal::impl */
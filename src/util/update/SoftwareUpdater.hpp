@@ -0,0 +1,287 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "SoftwareUpdaterBase.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../../Node.hpp"
+#include "../file/FileServerBase.hpp"
+#include "../../DSDL_Types/uavcan/node.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Updates the software of a set of nodes following the procedure
+ * of uavcan.node.ExecuteCommand: each node is sent the command
+ * BEGIN_SOFTWARE_UPDATE with the path of the image, which it then
+ * downloads from the file server of this node. A node is updated
+ * once it has left the SOFTWARE_UPDATE mode again, as reported by
+ * its heartbeat. To limit the load on the bus only a few nodes are
+ * updated at the same time and updates are started in intervals.
+ */
+class SoftwareUpdater final : public SoftwareUpdaterBase
+{
+public:
+  typedef uavcan::node::ExecuteCommand::Request_1_3 TExecuteCommandRequest;
+  typedef uavcan::node::ExecuteCommand::Response_1_3 TExecuteCommandResponse;
+  typedef uavcan::node::Heartbeat_1_0 THeartbeat;
+  typedef uavcan::node::Mode_1_0 TMode;
+
+  static CanardMicrosecond constexpr TX_TIMEOUT_usec           = 1000*1000UL;
+  static CanardMicrosecond constexpr RESPONSE_TIMEOUT_usec     = 1000*1000UL;
+  static uint8_t           constexpr MAX_RETRIES               = 3;
+  /* Time granted for the node to enter the software update mode
+   * (e.g. by restarting into its bootloader) and the maximum gap
+   * between its heartbeats while updating (e.g. when restarting
+   * into the new software).
+   */
+  static CanardMicrosecond constexpr UPDATE_START_TIMEOUT_usec = 10*1000*1000UL;
+  static CanardMicrosecond constexpr HEARTBEAT_TIMEOUT_usec    = 30*1000*1000UL;
+
+
+  SoftwareUpdater(Node & node_hdl,
+                  cyphal::Node::MicrosFunc const micros_func,
+                  cyphal::FileServer file_server,
+                  std::string const & image_path,
+                  std::vector<CanardNodeID> const & node_ids,
+                  size_t const max_concurrent_updates,
+                  CanardMicrosecond const start_interval_usec)
+  : _node_hdl{node_hdl}
+  , _micros_func{micros_func}
+  , _file_server{file_server}
+  , _max_concurrent_updates{std::max<size_t>(max_concurrent_updates, 1)}
+  , _start_interval_usec{start_interval_usec}
+  , _updates{}
+  , _prev_start{std::nullopt}
+  {
+    _cmd_req.command = TExecuteCommandRequest::COMMAND_BEGIN_SOFTWARE_UPDATE;
+    std::copy(image_path.cbegin(), image_path.cend(), std::back_inserter(_cmd_req.parameter));
+
+    _updates.reserve(node_ids.size());
+    for (auto const node_id : node_ids)
+      _updates.push_back(Update{node_id, State::Pending, 0, 0, 0, false, std::nullopt});
+
+    _cmd_client = _node_hdl.create_service_client<TExecuteCommandRequest, TExecuteCommandResponse>(
+      TX_TIMEOUT_usec,
+      [this](TExecuteCommandResponse const & rsp, TransferMetadata const & metadata)
+      {
+        onExecuteCommandResponse(rsp, metadata);
+      });
+
+    _heartbeat_sub = _node_hdl.create_subscription<THeartbeat>(
+      [this](THeartbeat const & msg, TransferMetadata const & metadata)
+      {
+        onHeartbeat(msg, metadata);
+      });
+
+    _node_hdl.add_updatable(this);
+  }
+
+  virtual ~SoftwareUpdater()
+  {
+    _node_hdl.remove_updatable(this);
+  }
+
+
+  [[nodiscard]] virtual std::optional<State> state(CanardNodeID const node_id) const override
+  {
+    auto const update = find(node_id);
+    if (!update)
+      return std::nullopt;
+    return update->state;
+  }
+
+  [[nodiscard]] virtual std::optional<uint64_t> progress(CanardNodeID const node_id) const override
+  {
+    if (!find(node_id))
+      return std::nullopt;
+    return readOffset(node_id).value_or(0);
+  }
+
+  [[nodiscard]] virtual bool is_finished() const override
+  {
+    return std::all_of(_updates.cbegin(),
+                       _updates.cend(),
+                       [](Update const & update)
+                       {
+                         return (update.state == State::Done) || (update.state == State::Failed);
+                       });
+  }
+
+  virtual void update() override
+  {
+    auto const now = _micros_func();
+
+    size_t active_updates = 0;
+    for (auto & update : _updates)
+    {
+      if ((update.state == State::Requested) && (now > update.deadline_usec))
+      {
+        if (update.retries >= MAX_RETRIES)
+          update.state = State::Failed;
+        else {
+          update.retries++;
+          request(update, now);
+        }
+      }
+
+      if ((update.state == State::Updating) && (now > update.deadline_usec))
+        update.state = State::Failed;
+
+      if ((update.state == State::Requested) || (update.state == State::Updating))
+        active_updates++;
+    }
+
+    if (active_updates >= _max_concurrent_updates)
+      return;
+
+    if (_prev_start.has_value() && ((now - _prev_start.value()) < _start_interval_usec))
+      return;
+
+    auto next = std::find_if(_updates.begin(),
+                             _updates.end(),
+                             [](Update const & update) { return update.state == State::Pending; });
+    if (next == _updates.end())
+      return;
+
+    _prev_start = now;
+    next->state = State::Requested;
+    request(*next, now);
+  }
+
+
+private:
+  struct Update
+  {
+    CanardNodeID node_id;
+    State state;
+    uint8_t retries;
+    CanardMicrosecond deadline_usec;
+    CanardMicrosecond accepted_usec;
+    bool is_in_update_mode;
+    std::optional<uint64_t> accepted_read_offset;
+  };
+
+  Node & _node_hdl;
+  cyphal::Node::MicrosFunc const _micros_func;
+  cyphal::FileServer _file_server;
+  size_t const _max_concurrent_updates;
+  CanardMicrosecond const _start_interval_usec;
+  std::vector<Update> _updates;
+  std::optional<CanardMicrosecond> _prev_start;
+  TExecuteCommandRequest _cmd_req;
+  cyphal::ServiceClient<TExecuteCommandRequest> _cmd_client;
+  cyphal::Subscription _heartbeat_sub;
+
+
+  [[nodiscard]] Update * find(CanardNodeID const node_id)
+  {
+    auto iter = std::find_if(_updates.begin(),
+                             _updates.end(),
+                             [node_id](Update const & update) { return update.node_id == node_id; });
+    return (iter != _updates.end()) ? &(*iter) : nullptr;
+  }
+
+  [[nodiscard]] Update const * find(CanardNodeID const node_id) const
+  {
+    return const_cast<SoftwareUpdater *>(this)->find(node_id);
+  }
+
+  [[nodiscard]] std::optional<uint64_t> readOffset(CanardNodeID const node_id) const
+  {
+    if (!_file_server)
+      return std::nullopt;
+    return _file_server->read_offset(node_id);
+  }
+
+  void request(Update & update, CanardMicrosecond const now)
+  {
+    update.deadline_usec = now + RESPONSE_TIMEOUT_usec;
+    /* A request which could not be enqueued is
+     * retried once its response timeout expires.
+     */
+    (void)_cmd_client->request(update.node_id, _cmd_req);
+  }
+
+  void onExecuteCommandResponse(TExecuteCommandResponse const & rsp, TransferMetadata const & metadata)
+  {
+    if (metadata.remote_node_id > CANARD_NODE_ID_MAX)
+      return;
+
+    Update * update = find(static_cast<CanardNodeID>(metadata.remote_node_id));
+    if (!update || (update->state != State::Requested))
+      return;
+
+    if (rsp.status != TExecuteCommandResponse::STATUS_SUCCESS) {
+      update->state = State::Failed;
+      return;
+    }
+
+    update->state = State::Updating;
+    update->accepted_usec = _micros_func();
+    update->deadline_usec = update->accepted_usec + UPDATE_START_TIMEOUT_usec;
+    update->accepted_read_offset = readOffset(update->node_id);
+  }
+
+  void onHeartbeat(THeartbeat const & msg, TransferMetadata const & metadata)
+  {
+    if (metadata.remote_node_id > CANARD_NODE_ID_MAX)
+      return;
+
+    Update * update = find(static_cast<CanardNodeID>(metadata.remote_node_id));
+    if (!update || (update->state != State::Updating))
+      return;
+
+    /* Heartbeats sent before the command was accepted
+     * may still report the previous mode of the node.
+     */
+    if (metadata.timestamp_usec < update->accepted_usec)
+      return;
+
+    /* Small images may be downloaded in between two heartbeats,
+     * hence reading from the file server counts as having entered
+     * the software update mode as well.
+     */
+    bool const is_in_update_mode = (msg.mode.value == TMode::SOFTWARE_UPDATE);
+    bool const has_read_image = (readOffset(update->node_id) != update->accepted_read_offset);
+
+    if (is_in_update_mode)
+    {
+      update->is_in_update_mode = true;
+      update->deadline_usec = _micros_func() + HEARTBEAT_TIMEOUT_usec;
+    }
+    else if (update->is_in_update_mode || has_read_image)
+      update->state = State::Done;
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+} /* cyphal */
@@ -0,0 +1,73 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <memory>
+#include <optional>
+
+#include <libcanard/canard.h>
+
+#include "../../UpdatableBase.hpp"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+namespace impl
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+class SoftwareUpdaterBase : public UpdatableBase
+{
+public:
+  enum class State
+  {
+    Pending,    /* Waiting for its turn. */
+    Requested,  /* BEGIN_SOFTWARE_UPDATE has been sent. */
+    Updating,   /* The node accepted the command and is updating. */
+    Done,       /* The node has left the software update mode. */
+    Failed,     /* The node refused the update or stopped responding. */
+  };
+
+
+  virtual ~SoftwareUpdaterBase() { }
+
+  [[nodiscard]] virtual std::optional<State> state(CanardNodeID const node_id) const = 0;
+  /* The number of image bytes the node has read so far. */
+  [[nodiscard]] virtual std::optional<uint64_t> progress(CanardNodeID const node_id) const = 0;
+  /* True once every node is either done or has failed. */
+  [[nodiscard]] virtual bool is_finished() const = 0;
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* impl */
+
+/**************************************************************************************
+ * TYPEDEF
+ **************************************************************************************/
+
+using SoftwareUpdater = std::shared_ptr<impl::SoftwareUpdaterBase>;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
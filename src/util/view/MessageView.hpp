@@ -0,0 +1,111 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <type_traits>
+
+#undef max
+#undef min
+#include <nunavut/support/serialization.hpp>
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* Read-only view onto the serialized representation of T within
+ * the payload of a received transfer. Fields are decoded lazily
+ * when accessed, reading beyond the end of the payload yields zero
+ * (implicit zero extension). A view refers to the memory of the
+ * transfer and is only valid within the callback it is passed to.
+ *
+ * Views can be used in place of T for create_subscription<T>()
+ * and for the response type of create_service_client<T_REQ, T_RSP>().
+ */
+template <typename T>
+class MessageView
+{
+public:
+  typedef T Message;
+  using _traits_ = typename T::_traits_;
+
+
+  MessageView(uint8_t const * const data, size_t const size)
+  : _data{data}
+  , _size{size}
+  { }
+
+
+  [[nodiscard]] nunavut::support::const_bitspan bitspan() const { return nunavut::support::const_bitspan(_data, _size); }
+  [[nodiscard]] size_t size() const { return _size; }
+
+  /* Falls back to deserializing the whole message. */
+  [[nodiscard]] std::optional<T> decode() const
+  {
+    T msg;
+    if (!deserialize(msg, bitspan()))
+      return std::nullopt;
+    return msg;
+  }
+
+
+protected:
+  uint8_t const * const _data;
+  size_t const _size;
+
+  /* Accessors for fields at a fixed bit offset. */
+  template <size_t OFFSET_BITS, uint8_t LEN_BITS>
+  [[nodiscard]] uint64_t getU() const
+  {
+    static_assert(LEN_BITS > 0 && LEN_BITS <= 64, "invalid field length");
+    return bitspan().at_offset(OFFSET_BITS).getU64(LEN_BITS);
+  }
+  template <size_t OFFSET_BITS, uint8_t LEN_BITS>
+  [[nodiscard]] int64_t getI() const
+  {
+    static_assert(LEN_BITS > 0 && LEN_BITS <= 64, "invalid field length");
+    return bitspan().at_offset(OFFSET_BITS).getI64(LEN_BITS);
+  }
+  template <size_t OFFSET_BITS>
+  [[nodiscard]] bool getBit() const
+  {
+    return bitspan().at_offset(OFFSET_BITS).getBit();
+  }
+};
+
+/**************************************************************************************
+ * TYPE TRAITS
+ **************************************************************************************/
+
+template <typename T, typename = void>
+struct is_message_view : std::false_type { };
+
+template <typename T>
+struct is_message_view<T, std::void_t<typename T::Message>> : std::is_base_of<MessageView<typename T::Message>, T> { };
+
+template <typename T>
+inline constexpr bool is_message_view_v = is_message_view<T>::value;
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
@@ -0,0 +1,182 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "MessageView.hpp"
+
+#include <utility>
+#include <algorithm>
+
+#include <libcanard/canard.h>
+
+#include "../../DSDL_Types/uavcan/node/port.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* uavcan.node.port.SubjectIDList.1.0:
+ *
+ * uint8 tag (0 = mask, 1 = sparse_list, 2 = total) | bool[8192] mask
+ *                                                  | uint8 length | SubjectID.1.0[<=255] (uint13 | void3)
+ *                                                  | Empty.1.0
+ */
+class SubjectIDListView
+{
+public:
+  static uint8_t  constexpr TAG_MASK        = 0;
+  static uint8_t  constexpr TAG_SPARSE_LIST = 1;
+  static uint8_t  constexpr TAG_TOTAL       = 2;
+  static uint16_t constexpr CAPACITY        = uavcan::node::port::SubjectIDList_1_0::CAPACITY;
+  static size_t   constexpr MAX_SPARSE_LIST_SIZE = 255;
+
+
+  SubjectIDListView(uint8_t const * const data, size_t const size)
+  : _bitspan{data, size}
+  { }
+
+
+  [[nodiscard]] uint8_t tag() const { return _bitspan.getU8(8U); }
+  [[nodiscard]] bool is_mask() const { return tag() == TAG_MASK; }
+  [[nodiscard]] bool is_sparse_list() const { return tag() == TAG_SPARSE_LIST; }
+  [[nodiscard]] bool is_total() const { return tag() == TAG_TOTAL; }
+
+  [[nodiscard]] size_t sparse_list_size() const
+  {
+    if (!is_sparse_list()) return 0;
+    return std::min<size_t>(_bitspan.at_offset(8U).getU8(8U), MAX_SPARSE_LIST_SIZE);
+  }
+  [[nodiscard]] CanardPortID sparse_list_at(size_t const idx) const
+  {
+    return _bitspan.at_offset(16U + idx * 16U).getU16(13U);
+  }
+
+  [[nodiscard]] bool contains(CanardPortID const subject_id) const
+  {
+    switch (tag())
+    {
+      case TAG_MASK:
+        return (subject_id < CAPACITY) && _bitspan.at_offset(8U + subject_id).getBit();
+      case TAG_SPARSE_LIST:
+        for (size_t i = 0, n = sparse_list_size(); i < n; i++)
+          if (sparse_list_at(i) == subject_id)
+            return true;
+        return false;
+      case TAG_TOTAL:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+
+private:
+  nunavut::support::const_bitspan const _bitspan;
+};
+
+/* uavcan.node.port.ServiceIDList.1.0: bool[512] mask */
+class ServiceIDListView
+{
+public:
+  static uint16_t constexpr CAPACITY = uavcan::node::port::ServiceIDList_1_0::CAPACITY;
+
+
+  ServiceIDListView(uint8_t const * const data, size_t const size)
+  : _bitspan{data, size}
+  { }
+
+
+  [[nodiscard]] bool contains(CanardPortID const service_id) const
+  {
+    return (service_id < CAPACITY) && _bitspan.at_offset(service_id).getBit();
+  }
+
+
+private:
+  nunavut::support::const_bitspan const _bitspan;
+};
+
+/* uavcan.node.port.List.1.0 consists of four delimited sections
+ * (uint32 byte length | payload) which are located by skipping the
+ * preceding sections, without decoding any of the lists:
+ *
+ * publishers (SubjectIDList) | subscribers (SubjectIDList) | clients (ServiceIDList) | servers (ServiceIDList)
+ */
+class PortListView final : public MessageView<uavcan::node::port::List_1_0>
+{
+public:
+  static size_t constexpr DELIMITER_HEADER_SIZE = 4;
+  static size_t constexpr NUM_SECTIONS          = 4;
+
+
+  using MessageView::MessageView;
+
+
+  /* False if any delimiter header exceeds the payload. */
+  [[nodiscard]] bool valid() const
+  {
+    size_t offset = 0;
+    for (size_t s = 0; s < NUM_SECTIONS; s++)
+    {
+      if ((offset + DELIMITER_HEADER_SIZE) > _size)
+        return false;
+      size_t const section_size = delimiterHeader(offset);
+      offset += DELIMITER_HEADER_SIZE;
+      if (section_size > (_size - offset))
+        return false;
+      offset += section_size;
+    }
+    return true;
+  }
+
+  [[nodiscard]] SubjectIDListView publishers () const { auto const [data, size] = section(0); return SubjectIDListView(data, size); }
+  [[nodiscard]] SubjectIDListView subscribers() const { auto const [data, size] = section(1); return SubjectIDListView(data, size); }
+  [[nodiscard]] ServiceIDListView clients    () const { auto const [data, size] = section(2); return ServiceIDListView(data, size); }
+  [[nodiscard]] ServiceIDListView servers    () const { auto const [data, size] = section(3); return ServiceIDListView(data, size); }
+
+
+private:
+  [[nodiscard]] size_t delimiterHeader(size_t const offset) const
+  {
+    return bitspan().at_offset(offset * 8U).getU32(32U);
+  }
+
+  /* Sections beyond the end of a truncated payload are empty. */
+  [[nodiscard]] std::pair<uint8_t const *, size_t> section(size_t const idx) const
+  {
+    size_t offset = 0;
+    for (size_t s = 0; s <= idx; s++)
+    {
+      if (offset >= _size)
+        return {_data, 0};
+      size_t const section_size = delimiterHeader(offset);
+      offset = std::min(offset + DELIMITER_HEADER_SIZE, _size);
+      if (s == idx)
+        return {_data + offset, std::min(section_size, _size - offset)};
+      offset += std::min(section_size, _size - offset);
+    }
+    return {_data, 0};
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */
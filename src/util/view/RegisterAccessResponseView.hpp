@@ -0,0 +1,189 @@
+/**
+ * This software is distributed under the terms of the MIT License.
+ * Copyright (c) 2020-2023 LXRobotics.
+ * Author: Alexander Entinger <alexander.entinger@lxrobotics.com>
+ * Contributors: https://github.com/107-systems/107-Arduino-Cyphal/graphs/contributors.
+ */
+
+#pragma once
+
+/**************************************************************************************
+ * INCLUDES
+ **************************************************************************************/
+
+#include "MessageView.hpp"
+
+#include <utility>
+#include <algorithm>
+#include <string_view>
+
+#include "../../DSDL_Types/uavcan/_register.h"
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+namespace cyphal
+{
+
+/**************************************************************************************
+ * CLASS DECLARATION
+ **************************************************************************************/
+
+/* uavcan.register.Value.1.0 is a union of sealed primitive arrays:
+ *
+ * uint8 tag | uint8/uint16 length | element[<=CAPACITY]
+ *
+ * The position of an element only depends on the tag, reading an
+ * element does not decode the preceding ones.
+ */
+class RegisterValueView
+{
+public:
+  typedef uavcan::_register::Value_1_0::VariantType::IndexOf IndexOf;
+
+
+  RegisterValueView(uint8_t const * const data, size_t const size)
+  : _data{data}
+  , _size{size}
+  , _bitspan{data, size}
+  { }
+
+
+  [[nodiscard]] size_t tag() const { return _bitspan.getU8(8U); }
+
+  [[nodiscard]] bool is_empty       () const { return tag() == IndexOf::empty; }
+  [[nodiscard]] bool is_string      () const { return tag() == IndexOf::string; }
+  [[nodiscard]] bool is_unstructured() const { return tag() == IndexOf::unstructured; }
+  [[nodiscard]] bool is_bit         () const { return tag() == IndexOf::bit; }
+  [[nodiscard]] bool is_integer     () const { return (tag() >= IndexOf::integer64) && (tag() <= IndexOf::integer8); }
+  [[nodiscard]] bool is_natural     () const { return (tag() >= IndexOf::natural64) && (tag() <= IndexOf::natural8); }
+  [[nodiscard]] bool is_real        () const { return (tag() >= IndexOf::real64)    && (tag() <= IndexOf::real16); }
+
+  /* The number of elements (bytes for string/unstructured). */
+  [[nodiscard]] size_t size() const
+  {
+    Layout const l = layout(tag());
+    if (l.length_bits == 0) return 0;
+    return std::min<size_t>(_bitspan.at_offset(TAG_BITS).getU16(l.length_bits), l.capacity);
+  }
+
+  /* The bytes of string/unstructured values, clamped to the payload. */
+  [[nodiscard]] std::pair<uint8_t const *, size_t> bytes() const
+  {
+    if (!is_string() && !is_unstructured())
+      return {_data, 0};
+    size_t const offset = (TAG_BITS + layout(tag()).length_bits) / 8U;
+    if (offset >= _size)
+      return {_data, 0};
+    return {_data + offset, std::min(size(), _size - offset)};
+  }
+  [[nodiscard]] std::string_view string() const
+  {
+    auto const [data, len] = bytes();
+    return std::string_view(reinterpret_cast<char const *>(data), len);
+  }
+
+  [[nodiscard]] bool bit(size_t const idx) const
+  {
+    return is_bit() && element(idx).getBit();
+  }
+  [[nodiscard]] int64_t integer(size_t const idx) const
+  {
+    if (!is_integer()) return 0;
+    return element(idx).getI64(layout(tag()).element_bits);
+  }
+  [[nodiscard]] uint64_t natural(size_t const idx) const
+  {
+    if (!is_natural()) return 0;
+    return element(idx).getU64(layout(tag()).element_bits);
+  }
+  [[nodiscard]] double real(size_t const idx) const
+  {
+    auto e = element(idx);
+    switch (tag())
+    {
+      case IndexOf::real64: return e.getF64();
+      case IndexOf::real32: return e.getF32();
+      case IndexOf::real16: return e.getF16();
+      default:              return 0.0;
+    }
+  }
+
+
+private:
+  static uint8_t constexpr TAG_BITS = 8;
+
+  struct Layout
+  {
+    uint8_t length_bits;
+    uint8_t element_bits;
+    uint16_t capacity;
+  };
+
+  static constexpr Layout layout(size_t const tag)
+  {
+    switch (tag)
+    {
+      case IndexOf::string:
+      case IndexOf::unstructured:
+      case IndexOf::integer8:
+      case IndexOf::natural8:  return Layout{16,  8,  256};
+      case IndexOf::bit:       return Layout{16,  1, 2048};
+      case IndexOf::integer64:
+      case IndexOf::natural64:
+      case IndexOf::real64:    return Layout{ 8, 64,   32};
+      case IndexOf::integer32:
+      case IndexOf::natural32:
+      case IndexOf::real32:    return Layout{ 8, 32,   64};
+      case IndexOf::integer16:
+      case IndexOf::natural16:
+      case IndexOf::real16:    return Layout{ 8, 16,  128};
+      default:                 return Layout{ 0,  0,    0};
+    }
+  }
+
+  /* Elements past the end of the array read as zero. */
+  [[nodiscard]] nunavut::support::const_bitspan element(size_t const idx) const
+  {
+    Layout const l = layout(tag());
+    if (idx >= size())
+      return nunavut::support::const_bitspan(_data, 0);
+    return _bitspan.at_offset(TAG_BITS + l.length_bits + idx * l.element_bits);
+  }
+
+  uint8_t const * const _data;
+  size_t const _size;
+  nunavut::support::const_bitspan const _bitspan;
+};
+
+/* uavcan.register.Access.Response.1.0:
+ *
+ * uint56 timestamp | bool mutable | bool persistent | void6 | Value.1.0
+ */
+class RegisterAccessResponseView final : public MessageView<uavcan::_register::Access::Response_1_0>
+{
+public:
+  static size_t constexpr VALUE_OFFSET = 8;
+
+
+  using MessageView::MessageView;
+
+
+  [[nodiscard]] uint64_t timestamp_usec() const { return getU<0, 56>(); }
+  [[nodiscard]] bool is_mutable   () const { return getBit<56>(); }
+  [[nodiscard]] bool is_persistent() const { return getBit<57>(); }
+
+  [[nodiscard]] RegisterValueView value() const
+  {
+    if (_size <= VALUE_OFFSET)
+      return RegisterValueView(_data, 0);
+    return RegisterValueView(_data + VALUE_OFFSET, _size - VALUE_OFFSET);
+  }
+};
+
+/**************************************************************************************
+ * NAMESPACE
+ **************************************************************************************/
+
+} /* cyphal */